@@ -75,9 +75,7 @@ AObject* ObjectSet::alloc_object(const uint64_t size, const ObMemAttr& attr)
 
   const int64_t ctx_id = blk_mgr_->get_tenant_ctx_allocator().get_ctx_id();
   abort_unless(ctx_id == attr.ctx_id_);
-  if (common::ObCtxIds::LIBEASY == ctx_id) {
-    do_free_dirty_list();
-  }
+  do_free_dirty_list();
 
   AObject* obj = NULL;
   if (alloc_size >= UINT32_MAX || 0 == alloc_size) {
@@ -405,35 +403,30 @@ void ObjectSet::free_object(AObject* obj)
     memset(obj->data_, 0xAA, obj->alloc_bytes_);
   }
 #endif
-  const int64_t ctx_id = blk_mgr_->get_tenant_ctx_allocator().get_ctx_id();
-  if (ctx_id == common::ObCtxIds::LIBEASY) {
-    if (locker_->trylock()) {
+  // Objects are freed by other threads than the allocating one quite often, do not wait for
+  // the set lock here. If it is held, the object is put to dirty list and freed by the holder.
+  if (locker_->trylock()) {
+    do_free_object(obj);
+    do_free_dirty_list();
+    locker_->unlock();
+  } else {
+    dirty_list_mutex_.lock();
+    if (dirty_objs_ < MAX_DIRTY_OBJS) {
+      dirty_objs_++;
+      if (OB_ISNULL(dirty_list_)) {
+        obj->next_ = nullptr;
+      } else {
+        obj->next_ = dirty_list_;
+      }
+      dirty_list_ = obj;
+      dirty_list_mutex_.unlock();
+    } else {
+      dirty_list_mutex_.unlock();
+      locker_->lock();
       do_free_object(obj);
       do_free_dirty_list();
       locker_->unlock();
-    } else {
-      dirty_list_mutex_.lock();
-      if (dirty_objs_ < 1000) {
-        dirty_objs_++;
-        if (OB_ISNULL(dirty_list_)) {
-          obj->next_ = nullptr;
-        } else {
-          obj->next_ = dirty_list_;
-        }
-        dirty_list_ = obj;
-        dirty_list_mutex_.unlock();
-      } else {
-        dirty_list_mutex_.unlock();
-        locker_->lock();
-        do_free_object(obj);
-        do_free_dirty_list();
-        locker_->unlock();
-      }
     }
-  } else {
-    locker_->lock();
-    do_free_object(obj);
-    locker_->unlock();
   }
 }
 
@@ -485,6 +478,7 @@ void ObjectSet::do_free_dirty_list()
 
 void ObjectSet::reset()
 {
+  do_free_dirty_list();
   if (mem_context_ != nullptr && blist_ != nullptr) {
     auto& leak_checker = common::ObMemLeakChecker::get_instance();
     const bool check_leak =
@@ -35,6 +35,7 @@ class ObjectSet {
   static const uint32_t MIN_FREE_CELLS = META_CELLS + 1 + (15 / AOBJECT_CELL_BYTES);  // next, prev pointer
   static const double FREE_LISTS_BUILD_RATIO;
   static const double BLOCK_CACHE_RATIO;
+  static const int64_t MAX_DIRTY_OBJS = 1000;
 
   typedef AObject* FreeList;
   typedef ABitSet BitMap;
@@ -14,6 +14,9 @@
 #include "lib/charset/ob_dtoa.h"
 #include "lib/charset/ob_uctype.h"
 #include "lib/utility/ob_macro_utils.h"
+#if defined(__x86_64__)
+#include <emmintrin.h>
+#endif
 
 #define IS_CONTINUATION_BYTE(c) (((c) ^ 0x80) < 0x40)
 
@@ -10367,6 +10370,61 @@ static inline void ob_tosort_unicode(uint32_t** sort_plane, ob_wc_t* wchar)
   }
 }
 
+/*
+  ASCII fast paths of utf8mb4_general_ci, 16 bytes at a time.
+  Sort weight of an ASCII char in sort00 is the char itself with 'a'..'z' folded
+  to 'A'..'Z', so pure ASCII chunks are folded and compared without decoding.
+*/
+#if defined(__x86_64__)
+static inline __m128i ob_ascii_tosort_16(__m128i chunk)
+{
+  const __m128i lower_begin = _mm_set1_epi8('a' - 1);
+  const __m128i lower_end = _mm_set1_epi8('z' + 1);
+  const __m128i is_lower = _mm_and_si128(_mm_cmpgt_epi8(chunk, lower_begin), _mm_cmplt_epi8(chunk, lower_end));
+  return _mm_sub_epi8(chunk, _mm_and_si128(is_lower, _mm_set1_epi8(0x20)));
+}
+#endif
+
+/* length of the common prefix of pure ASCII chunks equal after folding, always a char boundary */
+static inline size_t ob_ascii_ci_common_prefix(const unsigned char* src, const unsigned char* dst, size_t len)
+{
+  size_t pos = 0;
+#if defined(__x86_64__)
+  while (pos + 16 <= len) {
+    __m128i src_chunk = _mm_loadu_si128((const __m128i*)(src + pos));
+    __m128i dst_chunk = _mm_loadu_si128((const __m128i*)(dst + pos));
+    if (0 != _mm_movemask_epi8(_mm_or_si128(src_chunk, dst_chunk))) {
+      break;
+    } else {
+      unsigned int eq_mask = (unsigned int)_mm_movemask_epi8(
+          _mm_cmpeq_epi8(ob_ascii_tosort_16(src_chunk), ob_ascii_tosort_16(dst_chunk)));
+      if (0xFFFF != eq_mask) {
+        pos += __builtin_ctz(~eq_mask);
+        break;
+      }
+    }
+    pos += 16;
+  }
+#endif
+  return pos;
+}
+
+/* skip leading spaces of [str, end) */
+static inline const unsigned char* ob_skip_space_utf8mb4(const unsigned char* str, const unsigned char* end)
+{
+#if defined(__x86_64__)
+  const __m128i spaces = _mm_set1_epi8(' ');
+  while (str + 16 <= end &&
+         0xFFFF == _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)str), spaces))) {
+    str += 16;
+  }
+#endif
+  while (str < end && *str == ' ') {
+    str++;
+  }
+  return str;
+}
+
 static int ob_strnncoll_utf8mb4(
     const ObCharsetInfo* cs, const unsigned char* src, size_t src_len, const unsigned char* dst, size_t dst_len)
 {
@@ -10375,6 +10433,9 @@ static int ob_strnncoll_utf8mb4(
   const unsigned char* src_end = src + src_len;
   const unsigned char* dst_end = dst + dst_len;
   uint32_t** sort_pages = cs->caseinfo->sort_pages;
+  const size_t prefix_len = ob_ascii_ci_common_prefix(src, dst, src_len < dst_len ? src_len : dst_len);
+  src += prefix_len;
+  dst += prefix_len;
   while (src < src_end && dst < dst_end) {
     int src_res = ob_mb_wc_utf8mb4(src, src_end, &src_wchar);
     int dst_res = ob_mb_wc_utf8mb4(dst, dst_end, &dst_wchar);
@@ -10402,6 +10463,9 @@ static int ob_strnncollsp_utf8mb4(
   const unsigned char* src_end = src + src_len;
   const unsigned char* dst_end = dst + dst_len;
   uint32_t** sort_pages = cs->caseinfo->sort_pages;
+  const size_t prefix_len = ob_ascii_ci_common_prefix(src, dst, src_len < dst_len ? src_len : dst_len);
+  src += prefix_len;
+  dst += prefix_len;
   while (src < src_end && dst < dst_end) {
     int src_res = ob_mb_wc_utf8mb4(src, src_end, &src_wchar);
     int dst_res = ob_mb_wc_utf8mb4(dst, dst_end, &dst_wchar);
@@ -10428,9 +10492,9 @@ static int ob_strnncollsp_utf8mb4(
       swap = -1;
       res = -res;
     }
-    for (; src < src_end; src++) {
-      if (*src != ' ')
-        return (*src < ' ') ? -swap : swap;
+    src = ob_skip_space_utf8mb4(src, src_end);
+    if (src < src_end) {
+      return (*src < ' ') ? -swap : swap;
     }
   }
   return res;
@@ -10669,9 +10733,7 @@ static void ob_hash_sort_utf8mb4(const ObCharsetInfo* cs, const unsigned char* s
     We do this to be able to compare 'A ' and 'A' as identical
   */
   if (!calc_end_space) {
-    while (e > s && e[-1] == ' ') {
-      e--;
-    }
+    e = skip_trailing_space(s, slen);
   }
 
   if (NULL == hash_algo) {
@@ -10685,7 +10747,24 @@ static void ob_hash_sort_utf8mb4(const ObCharsetInfo* cs, const unsigned char* s
       s += res;
     }
   } else {
-    while ((res = ob_mb_wc_utf8mb4((unsigned char*)s, (unsigned char*)e, &wc)) > 0) {
+    while (1) {
+#if defined(__x86_64__)
+      /* sort weight of pure ASCII chunk is filled as 16 two-byte chars, same as the loop below */
+      if (s + 16 <= e && length + 32 <= HASH_BUFFER_LENGTH) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)s);
+        if (0 == _mm_movemask_epi8(chunk)) {
+          chunk = ob_ascii_tosort_16(chunk);
+          _mm_storeu_si128((__m128i*)(data + length), _mm_unpacklo_epi8(chunk, _mm_setzero_si128()));
+          _mm_storeu_si128((__m128i*)(data + length + 16), _mm_unpackhi_epi8(chunk, _mm_setzero_si128()));
+          length += 32;
+          s += 16;
+          continue;
+        }
+      }
+#endif
+      if ((res = ob_mb_wc_utf8mb4((unsigned char*)s, (unsigned char*)e, &wc)) <= 0) {
+        break;
+      }
       ob_tosort_unicode(sort_pages, &wc);
       if (length > HASH_BUFFER_LENGTH - 2 || (HASH_BUFFER_LENGTH - 2 == length && wc > 0xFFFF)) {
         *n1 = hash_algo((void*)&data, length, *n1);
@@ -0,0 +1,246 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_COMMON_HASH_COW_POINTER_HASHMAP_
+#define OCEANBASE_COMMON_HASH_COW_POINTER_HASHMAP_
+
+#include "lib/allocator/ob_malloc.h"
+#include "lib/atomic/ob_atomic.h"
+#include "lib/hash/ob_pointer_hashmap.h"
+
+namespace oceanbase {
+namespace common {
+namespace hash {
+/**
+ * pointer hash map which shares its shards with the maps it is assigned from.
+ *
+ * Keys are spread over shard_count small ObPointerHashMaps. assign() only copies the shard
+ * pointers and increases their reference counts, the shard a write falls into is copied
+ * first if it is still shared. So a map assigned from a huge map and then changed by a few
+ * keys costs shard_count pointers plus the touched shards, instead of the whole map.
+ *
+ * Writes are not thread safe, the same as ObPointerHashMap. Reference counts are atomic,
+ * so maps sharing shards can be read and destroyed by different threads.
+ */
+template <class K, class V, template <class, class> class GetKey, int64_t shard_count = 256>
+class ObCowPointerHashMap {
+  static const int64_t SHARD_MAP_MEM_SIZE = 1024;
+  typedef ObPointerHashMap<K, V, GetKey, SHARD_MAP_MEM_SIZE> ShardMap;
+  struct Shard {
+    explicit Shard(const lib::ObLabel& label) : ref_cnt_(1), map_(label)
+    {}
+    int64_t ref_cnt_;
+    ShardMap map_;
+  };
+  STATIC_ASSERT(shard_count > 0 && 0 == (shard_count & (shard_count - 1)), "shard count must be power of 2");
+
+public:
+  explicit ObCowPointerHashMap(const lib::ObLabel& label = ObModIds::OB_HASH_NODE) : label_(label)
+  {
+    memset(shards_, 0, sizeof(shards_));
+  }
+
+  ~ObCowPointerHashMap()
+  {
+    destroy();
+  }
+
+  // shards are created on the first write
+  int init()
+  {
+    return OB_SUCCESS;
+  }
+
+  void destroy()
+  {
+    for (int64_t i = 0; i < shard_count; ++i) {
+      dec_shard_ref(shards_[i]);
+      shards_[i] = NULL;
+    }
+  }
+
+  void clear()
+  {
+    destroy();
+  }
+
+  int assign(const ObCowPointerHashMap& other)
+  {
+    if (this != &other) {
+      destroy();
+      label_ = other.label_;
+      for (int64_t i = 0; i < shard_count; ++i) {
+        if (NULL != (shards_[i] = other.shards_[i])) {
+          (void)ATOMIC_AAF(&shards_[i]->ref_cnt_, 1);
+        }
+      }
+    }
+    return OB_SUCCESS;
+  }
+
+  /**
+   * @retval OB_SUCCESS  success
+   * @retval OB_HASH_EXIST key exist when overwrite = 0
+   * @retval other errors
+   */
+  int set_refactored(const K& key, const V& value, int overwrite = 0)
+  {
+    int ret = OB_SUCCESS;
+    Shard* shard = NULL;
+    if (OB_SUCCESS != (ret = get_writable_shard(key, shard))) {
+      COMMON_LOG(WARN, "get writable shard failed", K(ret));
+    } else {
+      ret = shard->map_.set_refactored(key, value, overwrite);
+    }
+    return ret;
+  }
+
+  /**
+   * @retval OB_SUCCESS get the corresponding value of key
+   * @retval OB_HASH_NOT_EXIST key does not exist
+   * @retval other errors
+   */
+  int get_refactored(const K& key, V& value) const
+  {
+    int ret = OB_SUCCESS;
+    const Shard* shard = shards_[shard_idx(key)];
+    if (NULL == shard) {
+      ret = OB_HASH_NOT_EXIST;
+    } else {
+      ret = shard->map_.get_refactored(key, value);
+    }
+    return ret;
+  }
+
+  /**
+   * @retval OB_SUCCESS erase the key
+   * @retval OB_HASH_NOT_EXIST key does not exist
+   * @retval other errors
+   */
+  int erase_refactored(const K& key)
+  {
+    int ret = OB_SUCCESS;
+    Shard* shard = NULL;
+    V value = V(0);
+    if (NULL == shards_[shard_idx(key)] || OB_SUCCESS != shards_[shard_idx(key)]->map_.get_refactored(key, value)) {
+      // do not copy a shared shard for a missing key
+      ret = OB_HASH_NOT_EXIST;
+    } else if (OB_SUCCESS != (ret = get_writable_shard(key, shard))) {
+      COMMON_LOG(WARN, "get writable shard failed", K(ret));
+    } else {
+      ret = shard->map_.erase_refactored(key);
+    }
+    return ret;
+  }
+
+  int64_t item_count() const
+  {
+    int64_t total_item_count = 0;
+    for (int64_t i = 0; i < shard_count; ++i) {
+      if (NULL != shards_[i]) {
+        total_item_count += shards_[i]->map_.item_count();
+      }
+    }
+    return total_item_count;
+  }
+
+  int64_t count() const
+  {
+    int64_t total_count = 0;
+    for (int64_t i = 0; i < shard_count; ++i) {
+      if (NULL != shards_[i]) {
+        total_count += shards_[i]->map_.count();
+      }
+    }
+    return total_count;
+  }
+
+  // number of shards this map does not share with others, for test and monitor
+  int64_t exclusive_shard_count() const
+  {
+    int64_t cnt = 0;
+    for (int64_t i = 0; i < shard_count; ++i) {
+      if (NULL != shards_[i] && 1 == ATOMIC_LOAD(&shards_[i]->ref_cnt_)) {
+        ++cnt;
+      }
+    }
+    return cnt;
+  }
+
+private:
+  static int64_t shard_idx(const K& key)
+  {
+    // use the high bits, the low bits choose the slot inside the shard
+    const uint64_t hash_val = do_hash(key) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<int64_t>((hash_val >> 32) & (shard_count - 1));
+  }
+
+  int get_writable_shard(const K& key, Shard*& shard)
+  {
+    int ret = OB_SUCCESS;
+    const int64_t idx = shard_idx(key);
+    Shard* new_shard = NULL;
+    shard = shards_[idx];
+    if (NULL != shard && 1 == ATOMIC_LOAD(&shard->ref_cnt_)) {
+      // exclusive, write in place
+    } else if (OB_SUCCESS != (ret = alloc_shard(new_shard))) {
+      COMMON_LOG(WARN, "alloc shard failed", K(ret));
+    } else if (NULL != shard && OB_SUCCESS != (ret = new_shard->map_.assign(shard->map_))) {
+      COMMON_LOG(WARN, "copy shard failed", K(ret));
+      dec_shard_ref(new_shard);
+      new_shard = NULL;
+    } else {
+      dec_shard_ref(shard);
+      shards_[idx] = new_shard;
+      shard = new_shard;
+    }
+    return ret;
+  }
+
+  int alloc_shard(Shard*& shard)
+  {
+    int ret = OB_SUCCESS;
+    void* buf = NULL;
+    if (NULL == (buf = ob_malloc(sizeof(Shard), label_))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      COMMON_LOG(WARN, "alloc shard failed", K(ret));
+    } else {
+      shard = new (buf) Shard(label_);
+      if (OB_SUCCESS != (ret = shard->map_.init())) {
+        COMMON_LOG(WARN, "init shard map failed", K(ret));
+        dec_shard_ref(shard);
+        shard = NULL;
+      }
+    }
+    return ret;
+  }
+
+  static void dec_shard_ref(Shard* shard)
+  {
+    if (NULL != shard && 0 == ATOMIC_SAF(&shard->ref_cnt_, 1)) {
+      shard->~Shard();
+      ob_free(shard);
+    }
+  }
+
+private:
+  lib::ObLabel label_;
+  Shard* shards_[shard_count];
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObCowPointerHashMap);
+};
+}  // namespace hash
+}  // namespace common
+}  // namespace oceanbase
+
+#endif  // OCEANBASE_COMMON_HASH_COW_POINTER_HASHMAP_
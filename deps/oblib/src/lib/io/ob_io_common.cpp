@@ -162,6 +162,7 @@ void ObIOConfig::set_default_value()
   disk_io_thread_count_ = DEFAULT_DISK_IO_THREAD_COUNT;
   callback_thread_count_ = DEFAULT_IO_CALLBACK_THREAD_COUNT;
   large_query_io_percent_ = DEFAULT_LARGE_QUERY_IO_PERCENT;
+  tmp_file_io_percent_ = DEFAULT_TMP_FILE_IO_PERCENT;
   data_storage_io_timeout_ms_ = DEFAULT_DATA_STORAGE_IO_TIMEOUT_MS;
 }
 
@@ -174,7 +175,7 @@ bool ObIOConfig::is_valid() const
          data_storage_error_tolerance_time_ >= data_storage_warning_tolerance_time_ && disk_io_thread_count_ > 0 &&
          disk_io_thread_count_ <= ObDisk::MAX_DISK_CHANNEL_CNT * 2 && disk_io_thread_count_ % 2 == 0 &&
          callback_thread_count_ > 0 && large_query_io_percent_ >= 0 && large_query_io_percent_ <= 100 &&
-         data_storage_io_timeout_ms_ > 0;
+         tmp_file_io_percent_ >= 0 && tmp_file_io_percent_ <= 100 && data_storage_io_timeout_ms_ > 0;
 }
 
 void ObIOConfig::reset()
@@ -190,6 +191,7 @@ void ObIOConfig::reset()
   disk_io_thread_count_ = 0;
   callback_thread_count_ = 0;
   large_query_io_percent_ = 0;
+  tmp_file_io_percent_ = 0;
   data_storage_io_timeout_ms_ = 0;
 }
 
@@ -61,7 +61,7 @@ enum ObIOMode {
   IO_MODE_MAX,
 };
 
-enum ObIOCategory { USER_IO = 0, SYS_IO = 1, PREWARM_IO = 2, LARGE_QUERY_IO = 3, MAX_IO_CATEGORY };
+enum ObIOCategory { USER_IO = 0, SYS_IO = 1, PREWARM_IO = 2, LARGE_QUERY_IO = 3, TMP_FILE_IO = 4, MAX_IO_CATEGORY };
 
 class ObIORequest;
 class ObDisk;
@@ -106,6 +106,7 @@ public:
   static const int64_t DEFAULT_DISK_IO_THREAD_COUNT = 8;
   static const int64_t DEFAULT_IO_CALLBACK_THREAD_COUNT = 8;
   static const int64_t DEFAULT_LARGE_QUERY_IO_PERCENT = 0;                 // 0 means unlimited
+  static const int64_t DEFAULT_TMP_FILE_IO_PERCENT = 0;                    // 0 means sharing user io
   static const int64_t DEFAULT_DATA_STORAGE_IO_TIMEOUT_MS = 120L * 1000L;  // 120s
 public:
   ObIOConfig()
@@ -118,7 +119,7 @@ public:
   TO_STRING_KV(K_(sys_io_low_percent), K_(sys_io_high_percent), K_(user_iort_up_percent), K_(cpu_high_water_level),
       K_(write_failure_detect_interval), K_(read_failure_black_list_interval), K_(data_storage_warning_tolerance_time),
       K_(data_storage_error_tolerance_time), K_(disk_io_thread_count), K_(callback_thread_count),
-      K_(large_query_io_percent), K_(data_storage_io_timeout_ms));
+      K_(large_query_io_percent), K_(tmp_file_io_percent), K_(data_storage_io_timeout_ms));
 
 public:
   // schedule related
@@ -135,6 +136,7 @@ public:
   int64_t disk_io_thread_count_;
   int64_t callback_thread_count_;
   int64_t large_query_io_percent_;
+  int64_t tmp_file_io_percent_;
   int64_t data_storage_io_timeout_ms_;
 };
 
@@ -131,6 +131,8 @@ ObDisk::ObDisk()
       sys_iops_up_limit_(DEFAULT_SYS_IOPS),
       large_query_io_deadline_time_(0),
       large_query_io_percent_(0),
+      tmp_file_io_deadline_time_(0),
+      tmp_file_io_percent_(0),
       real_max_channel_cnt_(-1)
 {
   for (int64_t i = 0; i < ObIOCategory::MAX_IO_CATEGORY; ++i) {
@@ -359,6 +361,12 @@ int ObDisk::update_request_deadline(ObIORequest& req)
         large_query_iops = DEFAULT_LARGE_QUERY_IOPS;
       }
     }
+    // temporary files have no quota unless they are split from user io
+    int64_t tmp_file_iops = 0;
+    if (tmp_file_io_percent_ > 0) {
+      tmp_file_iops = (IO_MODE_READ == req.master_->mode_) ? user_iops : sys_iops_up_limit_;
+      tmp_file_iops = tmp_file_iops > 0 ? max(1, tmp_file_iops * tmp_file_io_percent_ / 100) : DEFAULT_LARGE_QUERY_IOPS;
+    }
     // compute deadline time of this control
     const int64_t cur_time = ObTimeUtility::current_time();
     int64_t tmp_deadline_time = req.desc_.req_deadline_time_;
@@ -388,6 +396,15 @@ int ObDisk::update_request_deadline(ObIORequest& req)
             req.deadline_time_ = max(cur_time, tmp_deadline_time + 1000000L / large_query_iops);
           } while (!ATOMIC_BCAS(&large_query_io_deadline_time_, tmp_deadline_time, req.deadline_time_));
         }
+      } else if (req.desc_.category_ == TMP_FILE_IO) {
+        if (0 == tmp_file_iops) {
+          req.deadline_time_ = cur_time;
+        } else {
+          do {
+            tmp_deadline_time = tmp_file_io_deadline_time_;
+            req.deadline_time_ = max(cur_time, tmp_deadline_time + 1000000L / tmp_file_iops);
+          } while (!ATOMIC_BCAS(&tmp_file_io_deadline_time_, tmp_deadline_time, req.deadline_time_));
+        }
       } else {  // calculate deadline time for other io
         req.deadline_time_ = cur_time;
       }
@@ -405,10 +422,17 @@ int ObDisk::send_request(ObIORequest& req)
   } else if (OB_FAIL(update_request_deadline(req))) {
     COMMON_LOG(WARN, "fail to update req deadline", K(ret), K(req));
   } else {
-    const int64_t random_index = ObRandom::rand(0, channel_count_ - 1);
+    const int64_t channel_count = channel_count_;
+    int64_t random_index = 0;
+    if (tmp_file_io_percent_ > 0 && channel_count > 1) {
+      // temporary files own the last channel, spilling never queues ahead of user io
+      random_index = TMP_FILE_IO == req.desc_.category_ ? channel_count - 1 : ObRandom::rand(0, channel_count - 2);
+    } else {
+      random_index = ObRandom::rand(0, channel_count - 1);
+    }
     ObIOChannel& channel = channels_[random_index];
     if (OB_FAIL(channel.enqueue_request(req))) {
-      COMMON_LOG(WARN, "fail to enqueue request", K(ret), K(req), K(channel), K(random_index), K(channel_count_));
+      COMMON_LOG(WARN, "fail to enqueue request", K(ret), K(req), K(channel), K(random_index), K(channel_count));
     }
   }
   return ret;
@@ -470,6 +494,8 @@ void ObDisk::inner_schedule()
   const ObIOStatDiff& sys_write_io_stat = io_estimator_[ObIOCategory::SYS_IO][ObIOMode::IO_MODE_WRITE];
   const ObIOStatDiff& large_query_read_io_stat = io_estimator_[ObIOCategory::LARGE_QUERY_IO][ObIOMode::IO_MODE_READ];
   const ObIOStatDiff& large_query_write_io_stat = io_estimator_[ObIOCategory::LARGE_QUERY_IO][ObIOMode::IO_MODE_WRITE];
+  const ObIOStatDiff& tmp_file_read_io_stat = io_estimator_[ObIOCategory::TMP_FILE_IO][ObIOMode::IO_MODE_READ];
+  const ObIOStatDiff& tmp_file_write_io_stat = io_estimator_[ObIOCategory::TMP_FILE_IO][ObIOMode::IO_MODE_WRITE];
 
   if (user_read_io_stat.get_average_size() > 0 &&
       OB_SUCC(ObIOBenchmark::get_instance().get_min_rt(
@@ -492,6 +518,7 @@ void ObDisk::inner_schedule()
     sys_io_percent_ = min(io_conf.sys_io_high_percent_, sys_io_percent_ + 1);
   }
   large_query_io_percent_ = io_conf.large_query_io_percent_;
+  tmp_file_io_percent_ = io_conf.tmp_file_io_percent_;
   if (REACH_TIME_INTERVAL(1000 * 1000 * 10)) {
     COMMON_LOG(INFO,
         "Current io stat, ",
@@ -506,7 +533,9 @@ void ObDisk::inner_schedule()
         K(sys_read_io_stat),
         K(sys_write_io_stat),
         K(large_query_read_io_stat),
-        K(large_query_write_io_stat));
+        K(large_query_write_io_stat),
+        K(tmp_file_read_io_stat),
+        K(tmp_file_write_io_stat));
   }
 }
 
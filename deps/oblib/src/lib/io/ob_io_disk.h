@@ -182,6 +182,8 @@ private:
   int64_t sys_iops_up_limit_;
   int64_t large_query_io_deadline_time_;
   int64_t large_query_io_percent_;
+  int64_t tmp_file_io_deadline_time_;
+  int64_t tmp_file_io_percent_;
   int tg_id_;
   int real_max_channel_cnt_;
 };
@@ -60,6 +60,7 @@ enum ObDedupTaskType {
   T_CHECK_PG_RECOVERY_FINISHED = 31,
   T_UPDATE_FILE_RECOVERY_STATUS = 32,
   T_UPDATE_FILE_RECOVERY_STATUS_V2 = 33,
+  T_UPDATE_OPT_HISTOGRAM = 34,
 };
 
 class ObDedupQueue;
@@ -25,7 +25,7 @@ ObMemAttr attr;
 class TestObjectSet : public ::testing::Test {
   class ObjecSetLocker : public ISetLocker {
   public:
-    ObjecSetLocker()
+    ObjecSetLocker() : busy_(false)
     {}
     void lock() override
     {}
@@ -33,8 +33,9 @@ class TestObjectSet : public ::testing::Test {
     {}
     bool trylock() override
     {
-      return true;
+      return !busy_;
     }
+    bool busy_;
   };
 
 public:
@@ -269,6 +270,24 @@ TEST_F(TestObjectSet, Reset)
   }
 }
 
+TEST_F(TestObjectSet, FreeWhenLocked)
+{
+  void* p = Malloc(100);
+  check_ptr(p);
+  const uint64_t alloc_bytes = os_.get_alloc_bytes();
+  // lock is held by others, the object is kept in dirty list and still accounted
+  os_locker_.busy_ = true;
+  Free(p);
+  EXPECT_EQ(alloc_bytes, os_.get_alloc_bytes());
+  os_locker_.busy_ = false;
+  // freed by the next lock holder
+  p = Malloc(100);
+  check_ptr(p);
+  EXPECT_EQ(alloc_bytes, os_.get_alloc_bytes());
+  Free(p);
+  EXPECT_EQ(0, os_.get_alloc_bytes());
+}
+
 TEST_F(TestObjectSet, NormalObject)
 {
   void* p = NULL;
@@ -16,6 +16,7 @@
 #include <sys/time.h>
 #include <codecvt>
 #include "lib/charset/ob_charset.h"
+#include "lib/hash_func/wyhash.h"
 #include "lib/string/ob_string.h"
 #include "lib/utility/ob_print_utils.h"
 #include "gtest/gtest.h"
@@ -214,6 +215,22 @@ TEST_F(TestCharset, hash_sort)
   ASSERT_EQ(ret2, ret3);
 }
 
+TEST_F(TestCharset, long_ascii_general_ci)
+{
+  // longer than the 16 bytes chunk of ascii fast path, with a multi-byte char in the tail
+  const char* a = "Select_Priv_Of_The_Current_User_\xc3\xa9";
+  const char* b = "select_priv_of_the_current_user_\xc3\x89  ";
+  const char* c = "select_priv_of_the_current_user_\xc3\xaa";
+  const char* d = "select_priv_of_the_current_useR";
+  ASSERT_EQ(0, ObCharset::strcmp(CS_TYPE_UTF8MB4_GENERAL_CI, a, strlen(a), b, strlen(b)));
+  ASSERT_GT(0, ObCharset::strcmp(CS_TYPE_UTF8MB4_GENERAL_CI, a, strlen(a), c, strlen(c)));
+  ASSERT_LT(0, ObCharset::strcmp(CS_TYPE_UTF8MB4_GENERAL_CI, a, strlen(a), d, strlen(d)));
+  ASSERT_EQ(ObCharset::hash(CS_TYPE_UTF8MB4_GENERAL_CI, a, strlen(a), 0, false, wyhash),
+      ObCharset::hash(CS_TYPE_UTF8MB4_GENERAL_CI, b, strlen(b), 0, false, wyhash));
+  ASSERT_EQ(ObCharset::hash(CS_TYPE_UTF8MB4_GENERAL_CI, a, strlen(a), 0, false, NULL),
+      ObCharset::hash(CS_TYPE_UTF8MB4_GENERAL_CI, b, strlen(b), 0, false, NULL));
+}
+
 TEST_F(TestCharset, case_mode_equal)
 {
   ObString y1 = "Variable_name";
@@ -48,6 +48,8 @@ int ObExtLogFetcher::init(
     LOG_WARN("stream_map_ init error", K(ret));
   } else if (OB_FAIL(stream_allocator_.init(global_default_allocator, OB_MALLOC_NORMAL_BLOCK_SIZE))) {
     LOG_WARN("stream_allocator_ init error", K(ret));
+  } else if (OB_FAIL(read_ahead_.init(line_cache, log_engine))) {
+    LOG_WARN("read_ahead_ init error", K(ret));
   } else {
     stream_allocator_.set_label(STREAM_ALLOCATOR_LABEL);
     self_ = self;
@@ -1067,6 +1069,13 @@ int ObExtLogFetcher::fetch_log(const ObLogStreamFetchLogReq& req, ObLogStreamFet
           LOG_WARN("do fetch log error", K(ret), K(req), K(*stream));
         } else if (req.is_feedback_enabled() && OB_FAIL(feedback(req, invain_pkeys, resp))) {
           LOG_WARN("feedback error", K(ret), K(req), K(*stream));
+        } else if (frt.is_stream_fall_behind()) {
+          // prepare lines for the next round before liboblog asks for them,
+          // it is only an optimization, ignore the error
+          int tmp_ret = OB_SUCCESS;
+          if (OB_SUCCESS != (tmp_ret = read_ahead_.submit(stream_seq, *stream))) {
+            LOG_WARN("submit read ahead error", K(tmp_ret), K(stream_seq));
+          }
         }
         stream->finish_process();
       } else {
@@ -23,6 +23,7 @@
 #include "ob_log_fetcher_impl.h"
 #include "ob_log_reader_interface.h"
 #include "ob_external_stream.h"              // ObStream, ObStreamItem
+#include "ob_external_read_ahead.h"          // ObExtLogReadAhead
 #include "ob_external_traffic_controller.h"  // ObExtTrafficController
 #include "ob_log_line_cache.h"               // ObLogLineCache
 
@@ -84,7 +85,8 @@ public:
         stream_map_(),
         stream_allocator_(),
         stream_allocator_lock_(),
-        traffic_controller_()
+        traffic_controller_(),
+        read_ahead_()
   {}
   ~ObExtLogFetcher()
   {
@@ -105,6 +107,7 @@ public:
       log_engine_ = NULL;
       partition_service_ = NULL;
       traffic_controller_.reset();
+      read_ahead_.destroy();
       self_.reset();
     }
   }
@@ -261,6 +264,8 @@ private:
   // TODO: flow control currently does not work. refactor the flow control module later
   //       to make flow control take effect
   ObExtTrafficController traffic_controller_;
+  // load upcoming lines of lagging streams into line cache in background
+  ObExtLogReadAhead read_ahead_;
 };
 
 // some parameters and status during Fetch execution
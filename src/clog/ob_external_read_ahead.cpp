@@ -0,0 +1,261 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX EXTLOG
+
+#include "ob_external_read_ahead.h"
+#include <algorithm>
+#include "share/config/ob_server_config.h"
+#include "ob_log_line_cache.h"
+
+namespace oceanbase {
+using namespace common;
+using namespace clog;
+using namespace obrpc;
+namespace logservice {
+ObExtLogReadAhead::ObExtLogReadAhead() : in_flight_size_(0)
+{
+  MEMSET(stream_in_flight_size_, 0, sizeof(stream_in_flight_size_));
+}
+
+ObExtLogReadAhead::~ObExtLogReadAhead()
+{
+  destroy();
+}
+
+int ObExtLogReadAhead::init(ObLogLineCache& line_cache, ObILogEngine* log_engine)
+{
+  int ret = OB_SUCCESS;
+  if (ObLogFetcherImpl::is_inited_) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("ObExtLogReadAhead init twice", K(ret));
+  } else if (OB_ISNULL(log_engine)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(log_engine));
+  } else if (OB_FAIL(ObSimpleThreadPool::init(THREAD_NUM, TASK_NUM_LIMIT, "ExtReadAhead"))) {
+    LOG_WARN("ObSimpleThreadPool init error", K(ret));
+  } else if (OB_FAIL(ObLogFetcherImpl::init(line_cache, log_engine))) {
+    LOG_WARN("ObLogFetcherImpl init error", K(ret), KP(log_engine));
+  } else {
+    in_flight_size_ = 0;
+    MEMSET(stream_in_flight_size_, 0, sizeof(stream_in_flight_size_));
+    LOG_INFO("ObExtLogReadAhead init success", KP(log_engine));
+  }
+  if (OB_FAIL(ret)) {
+    destroy();
+  }
+  return ret;
+}
+
+void ObExtLogReadAhead::destroy()
+{
+  if (ObLogFetcherImpl::is_inited_) {
+    ObLogFetcherImpl::is_inited_ = false;
+    // tasks are freed by handle(), let workers drain the queue before stopping them,
+    // handle() skips the remaining lines once is_inited_ is reset
+    while (get_queue_num() > 0) {
+      usleep(1000);
+    }
+  }
+  ObSimpleThreadPool::destroy();
+  skip_hotcache_ = false;
+  line_cache_ = NULL;
+  log_engine_ = NULL;
+}
+
+int ObExtLogReadAhead::submit(const ObStreamSeq& stream_seq, const ObStream& stream)
+{
+  int ret = OB_SUCCESS;
+  const int64_t window_size = GCONF._extlog_read_ahead_window_size;
+  const int64_t io_budget = GCONF._extlog_read_ahead_io_budget;
+  const int64_t max_line_count = std::min(MAX_LINE_COUNT_PER_TASK, window_size / ObLogLineCache::LINE_SIZE);
+  const int64_t slot = static_cast<int64_t>(stream_seq.hash() % STREAM_SLOT_COUNT);
+  ReadAheadTask* task = NULL;
+
+  if (!ObLogFetcherImpl::is_inited_) {
+    ret = OB_NOT_INIT;
+  } else if (max_line_count <= 0 || io_budget <= 0) {
+    // read-ahead is turned off
+  } else if (ATOMIC_LOAD(&stream_in_flight_size_[slot]) >= window_size) {
+    // previous read-ahead of this stream is not finished yet
+  } else if (OB_ISNULL(task = static_cast<ReadAheadTask*>(ob_malloc(sizeof(ReadAheadTask), "ExtReadAhead")))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("alloc read ahead task failed", K(ret), K(stream_seq));
+  } else {
+    task->slot_ = slot;
+    task->line_count_ = 0;
+    if (OB_FAIL(collect_lines_(stream, max_line_count, *task))) {
+      LOG_WARN("collect lines failed", K(ret), K(stream_seq));
+    } else if (0 == task->line_count_) {
+      // all logs are served, nothing to read ahead
+    } else if (!acquire_budget_(slot, task->get_data_size(), window_size, io_budget)) {
+      LOG_TRACE("read ahead budget exhausted", K(stream_seq), K(*task), K(window_size), K(io_budget),
+          K(in_flight_size_));
+    } else if (OB_FAIL(push(task))) {
+      LOG_WARN("push read ahead task failed", K(ret), K(stream_seq), K(*task));
+      release_budget_(slot, task->get_data_size());
+    } else {
+      LOG_TRACE("submit read ahead task", K(stream_seq), K(*task));
+      task = NULL;
+    }
+  }
+
+  if (NULL != task) {
+    ob_free(task);
+    task = NULL;
+  }
+  return ret;
+}
+
+void ObExtLogReadAhead::handle(void* task)
+{
+  int ret = OB_SUCCESS;
+  ReadAheadTask* read_ahead_task = static_cast<ReadAheadTask*>(task);
+  if (OB_ISNULL(read_ahead_task)) {
+    LOG_WARN("invalid read ahead task", KP(task));
+  } else {
+    int64_t loaded_count = 0;
+    for (int64_t i = 0; ObLogFetcherImpl::is_inited_ && i < read_ahead_task->line_count_; i++) {
+      bool loaded = false;
+      if (OB_FAIL(read_ahead_line_(read_ahead_task->lines_[i], loaded))) {
+        LOG_WARN("read ahead line failed", K(ret), "line", read_ahead_task->lines_[i]);
+      } else if (loaded) {
+        loaded_count++;
+      }
+    }
+    LOG_TRACE("read ahead task done", K(*read_ahead_task), K(loaded_count));
+    release_budget_(read_ahead_task->slot_, read_ahead_task->get_data_size());
+    ob_free(read_ahead_task);
+    read_ahead_task = NULL;
+  }
+}
+
+int ObExtLogReadAhead::collect_lines_(const ObStream& stream, const int64_t max_line_count, ReadAheadTask& task) const
+{
+  int ret = OB_SUCCESS;
+  for (int64_t idx = 0; OB_SUCC(ret) && task.line_count_ < max_line_count && idx < stream.get_item_count(); idx++) {
+    const ObStreamItem* item = stream.get_item(idx);
+    if (OB_ISNULL(item)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("get null stream item", K(ret), K(idx), K(stream));
+    } else {
+      for (int64_t i = item->next_cursor_;
+           OB_SUCC(ret) && task.line_count_ < max_line_count && i < item->cursor_array_size_;
+           i++) {
+        const ObLogCursorExt& cursor = item->cursor_array_[i];
+        const offset_t end_offset = static_cast<offset_t>(cursor.get_offset() + cursor.get_size() - 1);
+        // a log entry may span two lines
+        if (OB_FAIL(add_line_(cursor.get_file_id(), cursor.get_offset(), max_line_count, task))) {
+          LOG_WARN("add line failed", K(ret), K(cursor));
+        } else if (OB_FAIL(add_line_(cursor.get_file_id(), end_offset, max_line_count, task))) {
+          LOG_WARN("add line failed", K(ret), K(cursor));
+        }
+      }
+    }
+  }
+
+  if (OB_SUCC(ret) && task.line_count_ > 0) {
+    // load lines in file order, partitions of one stream usually share lines
+    std::sort(task.lines_, task.lines_ + task.line_count_);
+    task.line_count_ = std::unique(task.lines_, task.lines_ + task.line_count_) - task.lines_;
+  }
+  return ret;
+}
+
+int ObExtLogReadAhead::add_line_(
+    const file_id_t file_id, const offset_t offset, const int64_t max_line_count, ReadAheadTask& task) const
+{
+  int ret = OB_SUCCESS;
+  LineAddr addr;
+  addr.file_id_ = file_id;
+  addr.line_offset_ = static_cast<offset_t>(lower_align(offset, ObLogLineCache::LINE_SIZE));
+  if (OB_UNLIKELY(max_line_count > MAX_LINE_COUNT_PER_TASK)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid max_line_count", K(ret), K(max_line_count));
+  } else if (task.line_count_ > 0 && addr == task.lines_[task.line_count_ - 1]) {
+    // logs of one partition are continuous in most cases, skip the duplicated line early
+  } else if (task.line_count_ < max_line_count) {
+    task.lines_[task.line_count_++] = addr;
+  }
+  return ret;
+}
+
+bool ObExtLogReadAhead::acquire_budget_(
+    const int64_t slot, const int64_t size, const int64_t window_size, const int64_t io_budget)
+{
+  bool bret = false;
+  if (ATOMIC_AAF(&in_flight_size_, size) > io_budget) {
+    (void)ATOMIC_SAF(&in_flight_size_, size);
+  } else if (ATOMIC_AAF(&stream_in_flight_size_[slot], size) > window_size) {
+    (void)ATOMIC_SAF(&stream_in_flight_size_[slot], size);
+    (void)ATOMIC_SAF(&in_flight_size_, size);
+  } else {
+    bret = true;
+  }
+  return bret;
+}
+
+void ObExtLogReadAhead::release_budget_(const int64_t slot, const int64_t size)
+{
+  (void)ATOMIC_SAF(&stream_in_flight_size_[slot], size);
+  (void)ATOMIC_SAF(&in_flight_size_, size);
+}
+
+int ObExtLogReadAhead::read_ahead_line_(const LineAddr& addr, bool& loaded)
+{
+  int ret = OB_SUCCESS;
+  // do not wait for lines which are being loaded by others
+  static const int64_t GET_LINE_TIMEOUT_US = 10 * 1000L;
+  char* line = NULL;
+  bool need_load_data = false;
+  ObReadCost read_cost;
+  loaded = false;
+
+  if (OB_ISNULL(line_cache_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("invalid line cache", K(ret), K(line_cache_));
+  } else if (OB_FAIL(line_cache_->get_line(
+                 addr.file_id_, addr.line_offset_, GET_LINE_TIMEOUT_US, line, need_load_data))) {
+    if (OB_ITEM_NOT_MATCH == ret || OB_EXCEED_MEM_LIMIT == ret || OB_TIMEOUT == ret) {
+      // block is occupied by other files or line cache is full, the fetcher will load it on demand
+      ret = OB_SUCCESS;
+    } else {
+      LOG_WARN("get_line from line cache fail", K(ret), K(addr));
+    }
+  } else if (OB_ISNULL(line)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("line cache get_line NULL value", K(ret), K(addr), K(need_load_data));
+  } else {
+    if (need_load_data) {
+      if (OB_FAIL(load_line_data_(line, addr.file_id_, addr.line_offset_, read_cost))) {
+        LOG_WARN("load_line_data_ fail", K(ret), K(addr));
+      }
+      const bool load_data_ready = (OB_SUCCESS == ret);
+      int tmp_ret = line_cache_->mark_line_status(addr.file_id_, addr.line_offset_, load_data_ready);
+      if (OB_SUCCESS != tmp_ret) {
+        LOG_WARN("mark_line_status fail", K(tmp_ret), K(addr), K(load_data_ready));
+        ret = (OB_SUCCESS == ret ? tmp_ret : ret);
+      }
+      loaded = (OB_SUCCESS == ret);
+    }
+    // nothing is consumed by read-ahead, do not count it as read size
+    int tmp_ret = line_cache_->revert_line(addr.file_id_, addr.line_offset_, 0);
+    if (OB_SUCCESS != tmp_ret) {
+      LOG_WARN("line cache revert_line fail", K(tmp_ret), K(addr));
+      ret = (OB_SUCCESS == ret ? tmp_ret : ret);
+    }
+  }
+  return ret;
+}
+
+}  // namespace logservice
+}  // namespace oceanbase
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_CLOG_OB_EXTERNAL_READ_AHEAD_
+#define OCEANBASE_CLOG_OB_EXTERNAL_READ_AHEAD_
+
+#include "lib/thread/ob_simple_thread_pool.h"
+#include "ob_log_define.h"
+#include "ob_log_fetcher_impl.h"
+#include "ob_external_stream.h"  // ObStream, ObStreamItem
+
+namespace oceanbase {
+namespace logservice {
+/*
+ * Read-ahead of lagging streams.
+ *
+ * A stream which falls behind reads all its logs from disk through the line cache, and each RPC waits for
+ * the synchronous line loading of its own logs. After a round of fetching, every ObStreamItem still holds
+ * the cursors of its upcoming logs, so the lines holding them are known before liboblog asks for them.
+ * ObExtLogReadAhead loads these lines into the line cache by background threads, so that the next RPC of
+ * the stream only copies data from memory.
+ *
+ * > The read-ahead window of a stream is capped by _extlog_read_ahead_window_size, in-flight bytes are
+ *   accounted in a slot chosen by hash of the stream seq, conflicting streams share one window.
+ * > All streams share the global I/O budget _extlog_read_ahead_io_budget, a task exceeding it is dropped.
+ */
+class ObExtLogReadAhead : public ObLogFetcherImpl, public common::ObSimpleThreadPool {
+public:
+  static const int64_t THREAD_NUM = 4;
+  static const int64_t TASK_NUM_LIMIT = 1024;
+  // at most 8M per task, lines beyond are left to the next round
+  static const int64_t MAX_LINE_COUNT_PER_TASK = 128;
+  static const int64_t STREAM_SLOT_COUNT = 1024;
+
+public:
+  ObExtLogReadAhead();
+  virtual ~ObExtLogReadAhead();
+  int init(clog::ObLogLineCache& line_cache, clog::ObILogEngine* log_engine);
+  void destroy();
+  // Called at the end of a fetch round while the stream is still held by the caller.
+  // Only line addresses are copied, the task never refers to the stream afterwards.
+  int submit(const obrpc::ObStreamSeq& stream_seq, const ObStream& stream);
+  virtual void handle(void* task);
+
+  int64_t get_in_flight_size() const
+  {
+    return ATOMIC_LOAD(&in_flight_size_);
+  }
+
+private:
+  struct LineAddr {
+    clog::file_id_t file_id_;
+    clog::offset_t line_offset_;
+
+    bool operator<(const LineAddr& other) const
+    {
+      return file_id_ < other.file_id_ || (file_id_ == other.file_id_ && line_offset_ < other.line_offset_);
+    }
+    bool operator==(const LineAddr& other) const
+    {
+      return file_id_ == other.file_id_ && line_offset_ == other.line_offset_;
+    }
+    TO_STRING_KV(K_(file_id), K_(line_offset));
+  };
+  struct ReadAheadTask {
+    int64_t slot_;
+    int64_t line_count_;
+    LineAddr lines_[MAX_LINE_COUNT_PER_TASK];
+
+    int64_t get_data_size() const
+    {
+      return line_count_ * clog::ObLogLineCache::LINE_SIZE;
+    }
+    TO_STRING_KV(K_(slot), K_(line_count));
+  };
+
+private:
+  int collect_lines_(const ObStream& stream, const int64_t max_line_count, ReadAheadTask& task) const;
+  int add_line_(const clog::file_id_t file_id, const clog::offset_t offset, const int64_t max_line_count,
+      ReadAheadTask& task) const;
+  bool acquire_budget_(const int64_t slot, const int64_t size, const int64_t window_size, const int64_t io_budget);
+  void release_budget_(const int64_t slot, const int64_t size);
+  int read_ahead_line_(const LineAddr& addr, bool& loaded);
+
+private:
+  int64_t in_flight_size_ CACHE_ALIGNED;
+  int64_t stream_in_flight_size_[STREAM_SLOT_COUNT];
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObExtLogReadAhead);
+};
+
+}  // namespace logservice
+}  // namespace oceanbase
+
+#endif
@@ -235,6 +235,10 @@ public:
   {
     return rr_pointer_;
   }
+  const ObStreamItem* get_item(const int64_t idx) const
+  {
+    return (idx >= 0 && idx < item_count_) ? items_ + idx : NULL;
+  }
   const LiboblogInstanceId& get_liboblog_instance_id() const
   {
     return liboblog_instance_id_;
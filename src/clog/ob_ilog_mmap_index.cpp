@@ -0,0 +1,652 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "ob_ilog_mmap_index.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "lib/checksum/ob_crc64.h"
+#include "lib/file/file_directory_utils.h"
+#include "ob_ilog_per_file_cache.h"  // for RawArray
+
+namespace oceanbase {
+using namespace common;
+namespace clog {
+STATIC_ASSERT(32 == sizeof(ObLogCursorExt), "ObLogCursorExt is persisted as raw bytes in mmap ilog index");
+
+int ObIlogMmapPartitionEntry::compare(const ObPartitionKey& pkey) const
+{
+  int cmp_ret = 0;
+  ObPartitionKey entry_pkey;
+  if (table_id_ != pkey.get_table_id()) {
+    cmp_ret = table_id_ < pkey.get_table_id() ? -1 : 1;
+  } else if (OB_SUCCESS != entry_pkey.init(table_id_, partition_id_, partition_cnt_)) {
+    cmp_ret = -1;
+  } else {
+    cmp_ret = entry_pkey.compare(pkey);
+  }
+  return cmp_ret;
+}
+
+ObIlogMmapIndexFile::ObIlogMmapIndexFile() : base_(NULL), size_(0), header_(), dir_(NULL), cursor_arr_(NULL)
+{
+  MEMSET(&header_, 0, sizeof(header_));
+}
+
+ObIlogMmapIndexFile::~ObIlogMmapIndexFile()
+{
+  close();
+}
+
+int ObIlogMmapIndexFile::open(const char* path, const int64_t ilog_file_size, const int64_t ilog_file_mtime)
+{
+  int ret = OB_SUCCESS;
+  int fd = -1;
+  struct stat st;
+  if (NULL != base_) {
+    ret = OB_INIT_TWICE;
+  } else if (OB_ISNULL(path)) {
+    ret = OB_INVALID_ARGUMENT;
+  } else if ((fd = ::open(path, O_RDONLY)) < 0) {
+    ret = (ENOENT == errno) ? OB_ENTRY_NOT_EXIST : OB_IO_ERROR;
+    if (OB_ENTRY_NOT_EXIST != ret) {
+      CSR_LOG(WARN, "open mmap ilog index failed", K(ret), K(path), K(errno));
+    }
+  } else if (0 != ::fstat(fd, &st)) {
+    ret = OB_IO_ERROR;
+    CSR_LOG(WARN, "fstat mmap ilog index failed", K(ret), K(path), K(errno));
+  } else if (st.st_size < static_cast<int64_t>(sizeof(ObIlogMmapIndexHeader))) {
+    ret = OB_INVALID_DATA;
+    CSR_LOG(WARN, "mmap ilog index is too small", K(ret), K(path), "size", st.st_size);
+  } else {
+    void* ptr = ::mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (MAP_FAILED == ptr) {
+      ret = OB_IO_ERROR;
+      CSR_LOG(WARN, "mmap ilog index failed", K(ret), K(path), K(errno));
+    } else {
+      base_ = static_cast<char*>(ptr);
+      size_ = st.st_size;
+      MEMCPY(&header_, base_, sizeof(header_));
+      dir_ = reinterpret_cast<const ObIlogMmapPartitionEntry*>(base_ + header_.dir_offset_);
+      cursor_arr_ = reinterpret_cast<const ObLogCursorExt*>(base_ + header_.cursor_offset_);
+      if (OB_FAIL(check_file_(ilog_file_size, ilog_file_mtime))) {
+        CSR_LOG(WARN, "mmap ilog index is corrupted or stale", K(ret), K(path), K(ilog_file_size), K(ilog_file_mtime),
+            K(*this));
+      } else {
+        (void)::madvise(base_, size_, MADV_RANDOM);
+        CSR_LOG(INFO, "open mmap ilog index success", K(path), K(*this));
+      }
+    }
+  }
+  if (fd >= 0) {
+    (void)::close(fd);
+  }
+  if (OB_FAIL(ret) && OB_INIT_TWICE != ret) {
+    close();
+  }
+  return ret;
+}
+
+void ObIlogMmapIndexFile::close()
+{
+  if (NULL != base_) {
+    (void)::munmap(base_, size_);
+  }
+  base_ = NULL;
+  size_ = 0;
+  MEMSET(&header_, 0, sizeof(header_));
+  dir_ = NULL;
+  cursor_arr_ = NULL;
+}
+
+int ObIlogMmapIndexFile::check_file_(const int64_t ilog_file_size, const int64_t ilog_file_mtime) const
+{
+  int ret = OB_SUCCESS;
+  const int64_t dir_len = header_.partition_count_ * static_cast<int64_t>(sizeof(ObIlogMmapPartitionEntry));
+  const int64_t cursor_len = header_.cursor_count_ * static_cast<int64_t>(sizeof(ObLogCursorExt));
+  if (!header_.is_valid()) {
+    ret = OB_INVALID_DATA;
+  } else if (header_.cursor_offset_ != header_.dir_offset_ + dir_len || size_ != header_.cursor_offset_ + cursor_len) {
+    ret = OB_INVALID_DATA;
+  } else if (header_.ilog_file_size_ != ilog_file_size || header_.ilog_file_mtime_ != ilog_file_mtime) {
+    // built from another ilog file with the same file id
+    ret = OB_INVALID_DATA;
+  } else if (header_.dir_checksum_ != static_cast<int64_t>(ob_crc64(dir_, dir_len))) {
+    ret = OB_CHECKSUM_ERROR;
+  } else if (header_.cursor_checksum_ != static_cast<int64_t>(ob_crc64(cursor_arr_, cursor_len))) {
+    ret = OB_CHECKSUM_ERROR;
+  }
+  return ret;
+}
+
+int ObIlogMmapIndexFile::search_partition_(const ObPartitionKey& pkey, const ObIlogMmapPartitionEntry*& entry) const
+{
+  int ret = OB_CURSOR_NOT_EXIST;
+  int64_t begin = 0;
+  int64_t end = header_.partition_count_ - 1;
+  entry = NULL;
+  while (OB_CURSOR_NOT_EXIST == ret && begin <= end) {
+    const int64_t middle = begin + (end - begin) / 2;
+    const int cmp_ret = dir_[middle].compare(pkey);
+    if (0 == cmp_ret) {
+      entry = dir_ + middle;
+      ret = OB_SUCCESS;
+    } else if (cmp_ret < 0) {
+      begin = middle + 1;
+    } else {
+      end = middle - 1;
+    }
+  }
+  return ret;
+}
+
+int ObIlogMmapIndexFile::get_cursor(
+    const ObPartitionKey& pkey, const uint64_t query_log_id, ObGetCursorResult& result) const
+{
+  int ret = OB_SUCCESS;
+  const ObIlogMmapPartitionEntry* entry = NULL;
+  if (OB_ISNULL(base_)) {
+    ret = OB_NOT_INIT;
+  } else if (!pkey.is_valid() || !is_valid_log_id(query_log_id) || !result.is_valid()) {
+    ret = OB_INVALID_ARGUMENT;
+    CSR_LOG(WARN, "invalid argument", K(ret), K(pkey), K(query_log_id), K(result));
+  } else if (OB_FAIL(search_partition_(pkey, entry))) {
+    CSR_LOG(TRACE, "partition not exist in mmap ilog index", K(ret), K(pkey), K(query_log_id), K(header_));
+  } else if (query_log_id < entry->min_log_id_ || query_log_id > entry->max_log_id_) {
+    ret = OB_CURSOR_NOT_EXIST;
+    CSR_LOG(TRACE, "log id not exist in mmap ilog index", K(ret), K(pkey), K(query_log_id), K(*entry));
+  } else {
+    const int64_t target_index = entry->start_index_ + static_cast<int64_t>(query_log_id - entry->min_log_id_);
+    const int64_t ret_len = std::min(static_cast<int64_t>(entry->max_log_id_ - query_log_id + 1), result.arr_len_);
+    if (target_index + ret_len > header_.cursor_count_) {
+      ret = OB_ERR_UNEXPECTED;
+      CSR_LOG(ERROR, "mmap ilog index entry out of range", K(ret), K(pkey), K(query_log_id), K(*entry), K(header_));
+    } else {
+      MEMCPY(result.csr_arr_, cursor_arr_ + target_index, sizeof(ObLogCursorExt) * ret_len);
+      result.ret_len_ = ret_len;
+    }
+  }
+  return ret;
+}
+
+ObIlogMmapIndexMgr::ObIlogMmapIndexMgr()
+    : is_inited_(false), lock_(), index_files_(), persist_lock_(), persist_tasks_()
+{
+  ilog_dir_[0] = '\0';
+  index_dir_[0] = '\0';
+}
+
+ObIlogMmapIndexMgr::~ObIlogMmapIndexMgr()
+{
+  destroy();
+}
+
+int ObIlogMmapIndexMgr::init(const char* ilog_dir)
+{
+  int ret = OB_SUCCESS;
+  int pret = 0;
+  if (is_inited_) {
+    ret = OB_INIT_TWICE;
+  } else if (OB_ISNULL(ilog_dir)) {
+    ret = OB_INVALID_ARGUMENT;
+    CSR_LOG(WARN, "invalid argument", K(ret), KP(ilog_dir));
+  } else if ((pret = snprintf(ilog_dir_, sizeof(ilog_dir_), "%s", ilog_dir)) <= 0 ||
+             pret >= static_cast<int>(sizeof(ilog_dir_))) {
+    ret = OB_BUF_NOT_ENOUGH;
+    CSR_LOG(WARN, "ilog dir is too long", K(ret), K(ilog_dir));
+  } else if ((pret = snprintf(index_dir_, sizeof(index_dir_), "%s", ilog_dir)) <= 0 ||
+             pret >= static_cast<int>(sizeof(index_dir_)) - INDEX_DIR_SUFFIX_LEN) {
+    ret = OB_BUF_NOT_ENOUGH;
+    CSR_LOG(WARN, "ilog dir is too long", K(ret), K(ilog_dir));
+  } else if (FALSE_IT(trim_dir_suffix_(pret))) {
+  } else if (OB_FAIL(FileDirectoryUtils::create_full_path(index_dir_))) {
+    CSR_LOG(WARN, "create mmap ilog index dir failed", K(ret), K(index_dir_));
+  } else if (OB_FAIL(index_files_.create(BUCKET_NUM, "IlogMmapIndex"))) {
+    CSR_LOG(WARN, "index_files_ create failed", K(ret));
+  } else {
+    is_inited_ = true;
+    CSR_LOG(INFO, "ObIlogMmapIndexMgr init success", K(index_dir_));
+  }
+  return ret;
+}
+
+void ObIlogMmapIndexMgr::destroy()
+{
+  SpinWLockGuard guard(lock_);
+  if (index_files_.created()) {
+    for (IndexFileMap::iterator iter = index_files_.begin(); iter != index_files_.end(); ++iter) {
+      if (NULL != iter->second) {
+        OB_DELETE(ObIlogMmapIndexFile, "IlogMmapIndex", iter->second);
+      }
+    }
+    index_files_.destroy();
+  }
+  ObSpinLockGuard persist_guard(persist_lock_);
+  for (int64_t i = 0; i < persist_tasks_.count(); i++) {
+    free_persist_task_(persist_tasks_.at(i));
+  }
+  persist_tasks_.reset();
+  is_inited_ = false;
+}
+
+// the index dir is a sibling of ilog dir, "store/ilog/" => "store/ilog_index"
+void ObIlogMmapIndexMgr::trim_dir_suffix_(int64_t len)
+{
+  while (len > 1 && '/' == index_dir_[len - 1]) {
+    index_dir_[--len] = '\0';
+  }
+  MEMCPY(index_dir_ + len, "_index", INDEX_DIR_SUFFIX_LEN + 1);
+}
+
+int ObIlogMmapIndexMgr::format_path_(const file_id_t file_id, const bool is_tmp, char* path, const int64_t size) const
+{
+  int ret = OB_SUCCESS;
+  const int pret = snprintf(path, size, "%s/%u%s", index_dir_, file_id, is_tmp ? ".tmp" : "");
+  if (pret <= 0 || pret >= size) {
+    ret = OB_BUF_NOT_ENOUGH;
+    CSR_LOG(WARN, "mmap ilog index path is too long", K(ret), K(index_dir_), K(file_id));
+  }
+  return ret;
+}
+
+int ObIlogMmapIndexMgr::stat_ilog_file_(const file_id_t file_id, int64_t& size, int64_t& mtime) const
+{
+  int ret = OB_SUCCESS;
+  char path[MAX_PATH_SIZE];
+  struct stat st;
+  const int pret = snprintf(path, sizeof(path), "%s/%u", ilog_dir_, file_id);
+  if (pret <= 0 || pret >= static_cast<int>(sizeof(path))) {
+    ret = OB_BUF_NOT_ENOUGH;
+    CSR_LOG(WARN, "ilog file path is too long", K(ret), K(ilog_dir_), K(file_id));
+  } else if (0 != ::stat(path, &st)) {
+    ret = (ENOENT == errno) ? OB_ENTRY_NOT_EXIST : OB_IO_ERROR;
+    CSR_LOG(WARN, "stat ilog file failed", K(ret), K(path), K(errno));
+  } else {
+    size = st.st_size;
+    mtime = st.st_mtim.tv_sec * 1000000000L + st.st_mtim.tv_nsec;
+  }
+  return ret;
+}
+
+void ObIlogMmapIndexMgr::free_index_file_(ObIlogMmapIndexFile* index_file)
+{
+  if (NULL != index_file) {
+    OB_DELETE(ObIlogMmapIndexFile, "IlogMmapIndex", index_file);
+  }
+}
+
+int ObIlogMmapIndexMgr::open_index_file_(const file_id_t file_id)
+{
+  int ret = OB_SUCCESS;
+  char path[MAX_PATH_SIZE];
+  int64_t ilog_file_size = 0;
+  int64_t ilog_file_mtime = 0;
+  ObIlogMmapIndexFile* index_file = NULL;
+  ObIlogMmapIndexFile* exist_file = NULL;
+  if (OB_FAIL(format_path_(file_id, false, path, sizeof(path)))) {
+  } else if (OB_ISNULL(index_file = OB_NEW(ObIlogMmapIndexFile, "IlogMmapIndex"))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+  } else {
+    int open_ret = OB_SUCCESS;
+    if (OB_SUCCESS != (open_ret = stat_ilog_file_(file_id, ilog_file_size, ilog_file_mtime))) {
+      // can not tell whether the index matches the ilog file, do not use it
+    } else if (OB_SUCCESS != (open_ret = index_file->open(path, ilog_file_size, ilog_file_mtime))) {
+      if (OB_ENTRY_NOT_EXIST != open_ret) {
+        CSR_LOG(WARN, "open mmap ilog index failed, ignore it", K(open_ret), K(file_id), K(path));
+        (void)FileDirectoryUtils::delete_file(path);
+      }
+    }
+    if (OB_SUCCESS != open_ret) {
+      // Remember the missing index by a NULL entry, so queries on this file do
+      // not hit the file system again until persist() publishes one.
+      free_index_file_(index_file);
+      index_file = NULL;
+    }
+  }
+  if (OB_SUCC(ret)) {
+    SpinWLockGuard guard(lock_);
+    if (OB_HASH_NOT_EXIST != index_files_.get_refactored(file_id, exist_file)) {
+      // published by a concurrent query or persist(), keep that one
+    } else if (OB_FAIL(index_files_.set_refactored(file_id, index_file))) {
+      CSR_LOG(WARN, "index_files_ set failed", K(ret), K(file_id));
+    } else {
+      index_file = NULL;
+    }
+  }
+  free_index_file_(index_file);
+  return ret;
+}
+
+int ObIlogMmapIndexMgr::get_cursor_(const file_id_t file_id, const ObPartitionKey& pkey, const uint64_t query_log_id,
+    ObGetCursorResult& result, bool& need_open)
+{
+  int ret = OB_SUCCESS;
+  ObIlogMmapIndexFile* index_file = NULL;
+  SpinRLockGuard guard(lock_);
+  need_open = false;
+  if (OB_FAIL(index_files_.get_refactored(file_id, index_file))) {
+    if (OB_HASH_NOT_EXIST == ret) {
+      need_open = true;
+      ret = OB_SUCCESS;
+    }
+  } else if (NULL == index_file) {
+    ret = OB_ENTRY_NOT_EXIST;
+  } else {
+    ret = index_file->get_cursor(pkey, query_log_id, result);
+  }
+  return ret;
+}
+
+int ObIlogMmapIndexMgr::get_cursor(
+    const file_id_t file_id, const ObPartitionKey& pkey, const uint64_t query_log_id, ObGetCursorResult& result)
+{
+  int ret = OB_SUCCESS;
+  bool need_open = false;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (!is_valid_file_id(file_id) || !pkey.is_valid() || !is_valid_log_id(query_log_id) ||
+             !result.is_valid()) {
+    ret = OB_INVALID_ARGUMENT;
+    CSR_LOG(WARN, "invalid argument", K(ret), K(file_id), K(pkey), K(query_log_id), K(result));
+  } else if (OB_FAIL(get_cursor_(file_id, pkey, query_log_id, result, need_open))) {
+  } else if (!need_open) {
+    // done
+  } else if (OB_FAIL(open_index_file_(file_id))) {
+  } else if (OB_FAIL(get_cursor_(file_id, pkey, query_log_id, result, need_open))) {
+  } else if (need_open) {
+    // removed concurrently
+    ret = OB_ENTRY_NOT_EXIST;
+  }
+  return ret;
+}
+
+int64_t ObIlogMmapIndexMgr::count_partitions_(const RawArray& raw_array)
+{
+  int64_t partition_count = 0;
+  for (int64_t idx = 0; idx < raw_array.count_; idx++) {
+    if (0 == idx || raw_array.arr_[idx].get_partition_key() != raw_array.arr_[idx - 1].get_partition_key()) {
+      partition_count++;
+    }
+  }
+  return partition_count;
+}
+
+int ObIlogMmapIndexMgr::build_partition_dir_(const RawArray& raw_array, ObIlogMmapPartitionEntry* dir,
+    const int64_t dir_size, int64_t& partition_count) const
+{
+  int ret = OB_SUCCESS;
+  ObPartitionKey cur_pkey;
+  partition_count = 0;
+  for (int64_t idx = 0; OB_SUCC(ret) && idx < raw_array.count_; idx++) {
+    const ObIndexEntry& ilog_entry = raw_array.arr_[idx];
+    const ObPartitionKey& pkey = ilog_entry.get_partition_key();
+    const uint64_t log_id = ilog_entry.get_log_id();
+    if (pkey != cur_pkey) {
+      if (partition_count >= dir_size) {
+        ret = OB_SIZE_OVERFLOW;
+      } else {
+        ObIlogMmapPartitionEntry& entry = dir[partition_count++];
+        entry.table_id_ = pkey.get_table_id();
+        entry.partition_id_ = pkey.get_partition_id();
+        entry.partition_cnt_ = pkey.get_partition_cnt();
+        entry.min_log_id_ = log_id;
+        entry.max_log_id_ = log_id;
+        entry.start_index_ = idx;
+        cur_pkey = pkey;
+      }
+    } else if (dir[partition_count - 1].max_log_id_ + 1 != log_id) {
+      // offset calculation relies on continuous log ids in one partition
+      ret = OB_ERR_UNEXPECTED;
+      CSR_LOG(WARN, "log id is not continuous", K(ret), K(pkey), K(log_id), "entry", dir[partition_count - 1]);
+    } else {
+      dir[partition_count - 1].max_log_id_ = log_id;
+    }
+  }
+  return ret;
+}
+
+int ObIlogMmapIndexMgr::build_persist_task_(const file_id_t file_id, const RawArray& raw_array, PersistTask& task) const
+{
+  int ret = OB_SUCCESS;
+  const int64_t dir_size = count_partitions_(raw_array);
+  const int64_t dir_len = dir_size * static_cast<int64_t>(sizeof(ObIlogMmapPartitionEntry));
+  const int64_t cursor_len = raw_array.count_ * static_cast<int64_t>(sizeof(ObLogCursorExt));
+  char* buf = NULL;
+  task.file_id_ = file_id;
+  task.partition_count_ = 0;
+  task.cursor_count_ = raw_array.count_;
+  task.dir_ = NULL;
+  task.cursor_arr_ = NULL;
+  if (OB_ISNULL(buf = static_cast<char*>(ob_malloc(dir_len + cursor_len, "IlogMmapIndex")))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    CSR_LOG(WARN, "alloc persist task failed", K(ret), K(file_id), K(dir_size), K(raw_array));
+  } else {
+    task.dir_ = reinterpret_cast<ObIlogMmapPartitionEntry*>(buf);
+    task.cursor_arr_ = reinterpret_cast<ObLogCursorExt*>(buf + dir_len);
+    if (OB_FAIL(build_partition_dir_(raw_array, task.dir_, dir_size, task.partition_count_))) {
+      CSR_LOG(WARN, "build_partition_dir_ failed", K(ret), K(file_id), K(dir_size));
+    } else {
+      for (int64_t i = 0; i < raw_array.count_; i++) {
+        const ObIndexEntry& entry = raw_array.arr_[i];
+        task.cursor_arr_[i].reset(entry.get_file_id(),
+            entry.get_offset(),
+            entry.get_size(),
+            entry.get_accum_checksum(),
+            entry.get_submit_timestamp(),
+            entry.is_batch_committed());
+      }
+    }
+  }
+  if (OB_FAIL(ret)) {
+    free_persist_task_(task);
+  }
+  return ret;
+}
+
+void ObIlogMmapIndexMgr::free_persist_task_(PersistTask& task)
+{
+  if (NULL != task.dir_) {
+    ob_free(task.dir_);
+  }
+  task.dir_ = NULL;
+  task.cursor_arr_ = NULL;
+}
+
+int ObIlogMmapIndexMgr::write_all_(const int fd, const char* buf, const int64_t len)
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  while (OB_SUCC(ret) && pos < len) {
+    const ssize_t write_len = ::write(fd, buf + pos, len - pos);
+    if (write_len < 0 && EINTR == errno) {
+      // retry
+    } else if (write_len <= 0) {
+      ret = OB_IO_ERROR;
+      CSR_LOG(WARN, "write mmap ilog index failed", K(ret), K(fd), K(len), K(pos), K(errno));
+    } else {
+      pos += write_len;
+    }
+  }
+  return ret;
+}
+
+int ObIlogMmapIndexMgr::write_index_file_(const PersistTask& task)
+{
+  int ret = OB_SUCCESS;
+  char tmp_path[MAX_PATH_SIZE];
+  char path[MAX_PATH_SIZE];
+  int fd = -1;
+  const int64_t dir_len = task.partition_count_ * static_cast<int64_t>(sizeof(ObIlogMmapPartitionEntry));
+  const int64_t cursor_len = task.cursor_count_ * static_cast<int64_t>(sizeof(ObLogCursorExt));
+  ObIlogMmapIndexHeader header;
+  MEMSET(&header, 0, sizeof(header));
+  header.magic_ = ObIlogMmapIndexHeader::MAGIC;
+  header.version_ = ObIlogMmapIndexHeader::VERSION;
+  header.file_id_ = task.file_id_;
+  header.partition_count_ = task.partition_count_;
+  header.cursor_count_ = task.cursor_count_;
+  header.dir_offset_ = sizeof(ObIlogMmapIndexHeader);
+  header.cursor_offset_ = header.dir_offset_ + dir_len;
+  header.dir_checksum_ = static_cast<int64_t>(ob_crc64(task.dir_, dir_len));
+  header.cursor_checksum_ = static_cast<int64_t>(ob_crc64(task.cursor_arr_, cursor_len));
+
+  if (OB_FAIL(format_path_(task.file_id_, true, tmp_path, sizeof(tmp_path)))) {
+  } else if (OB_FAIL(format_path_(task.file_id_, false, path, sizeof(path)))) {
+  } else if (OB_FAIL(stat_ilog_file_(task.file_id_, header.ilog_file_size_, header.ilog_file_mtime_))) {
+    CSR_LOG(WARN, "stat ilog file failed", K(ret), K(task));
+  } else if ((fd = ::open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH)) < 0) {
+    ret = OB_IO_ERROR;
+    CSR_LOG(WARN, "create mmap ilog index failed", K(ret), K(tmp_path), K(errno));
+  } else if (OB_FAIL(write_all_(fd, reinterpret_cast<const char*>(&header), sizeof(header)))) {
+  } else if (OB_FAIL(write_all_(fd, reinterpret_cast<const char*>(task.dir_), dir_len))) {
+  } else if (OB_FAIL(write_all_(fd, reinterpret_cast<const char*>(task.cursor_arr_), cursor_len))) {
+  } else if (0 != ::fsync(fd)) {
+    ret = OB_IO_ERROR;
+    CSR_LOG(WARN, "fsync mmap ilog index failed", K(ret), K(tmp_path), K(errno));
+  }
+  if (fd >= 0) {
+    (void)::close(fd);
+  }
+  if (OB_SUCC(ret) && 0 != ::rename(tmp_path, path)) {
+    ret = OB_IO_ERROR;
+    CSR_LOG(WARN, "rename mmap ilog index failed", K(ret), K(tmp_path), K(path), K(errno));
+  }
+  if (OB_FAIL(ret) && fd >= 0) {
+    (void)::unlink(tmp_path);
+  }
+  return ret;
+}
+
+// called after ObIlogPerFileCacheBuilder loaded an old version ilog file, only
+// copies the cursors, the index file is written by do_persist_tasks().
+int ObIlogMmapIndexMgr::persist(const file_id_t file_id, const RawArray& raw_array)
+{
+  int ret = OB_SUCCESS;
+  bool is_pending = false;
+  PersistTask task;
+  task.dir_ = NULL;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (!is_valid_file_id(file_id) || !raw_array.is_valid()) {
+    ret = OB_INVALID_ARGUMENT;
+    CSR_LOG(WARN, "invalid argument", K(ret), K(file_id), K(raw_array));
+  } else {
+    {
+      ObSpinLockGuard guard(persist_lock_);
+      ret = check_persist_task_(file_id, is_pending);
+    }
+    if (OB_FAIL(ret) || is_pending) {
+      // the same file is loaded again before its index is written
+    } else if (OB_FAIL(build_persist_task_(file_id, raw_array, task))) {
+      CSR_LOG(WARN, "build_persist_task_ failed", K(ret), K(file_id));
+    } else {
+      ObSpinLockGuard guard(persist_lock_);
+      // check again, the task is built without lock
+      if (OB_FAIL(check_persist_task_(file_id, is_pending)) || is_pending) {
+      } else if (OB_FAIL(persist_tasks_.push_back(task))) {
+        CSR_LOG(WARN, "persist_tasks_ push_back failed", K(ret), K(task));
+      } else {
+        CSR_LOG(INFO, "submit mmap ilog index persist task success", K(task));
+        task.dir_ = NULL;
+      }
+    }
+  }
+  free_persist_task_(task);
+  return ret;
+}
+
+// caller must hold persist_lock_
+int ObIlogMmapIndexMgr::check_persist_task_(const file_id_t file_id, bool& is_pending) const
+{
+  int ret = OB_SUCCESS;
+  is_pending = false;
+  for (int64_t i = 0; !is_pending && i < persist_tasks_.count(); i++) {
+    is_pending = (file_id == persist_tasks_.at(i).file_id_);
+  }
+  if (!is_pending && persist_tasks_.count() >= MAX_PENDING_PERSIST_COUNT) {
+    ret = OB_EAGAIN;
+    CSR_LOG(WARN, "too many mmap ilog index persist tasks", K(ret), K(file_id), "count", persist_tasks_.count());
+  }
+  return ret;
+}
+
+bool ObIlogMmapIndexMgr::pop_persist_task_(PersistTask& task)
+{
+  ObSpinLockGuard guard(persist_lock_);
+  return OB_SUCCESS == persist_tasks_.pop_back(task);
+}
+
+int ObIlogMmapIndexMgr::do_persist_tasks()
+{
+  int ret = OB_SUCCESS;
+  PersistTask task;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else {
+    while (pop_persist_task_(task)) {
+      int tmp_ret = OB_SUCCESS;
+      if (OB_SUCCESS != (tmp_ret = write_index_file_(task))) {
+        // the file will be loaded into ObIlogCache again after being washed, persist it again then
+        ret = tmp_ret;
+        CSR_LOG(WARN, "write_index_file_ failed", K(ret), K(task));
+      } else {
+        // drop the published entry so the next query maps the new index
+        ObIlogMmapIndexFile* index_file = NULL;
+        {
+          SpinWLockGuard guard(lock_);
+          (void)index_files_.erase_refactored(task.file_id_, &index_file);
+        }
+        free_index_file_(index_file);
+        CSR_LOG(INFO, "persist mmap ilog index success", K(task));
+      }
+      free_persist_task_(task);
+    }
+  }
+  return ret;
+}
+
+int ObIlogMmapIndexMgr::remove(const file_id_t file_id)
+{
+  int ret = OB_SUCCESS;
+  char path[MAX_PATH_SIZE];
+  ObIlogMmapIndexFile* index_file = NULL;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (OB_FAIL(format_path_(file_id, false, path, sizeof(path)))) {
+  } else {
+    {
+      // remove() and do_persist_tasks() both run in the ilog storage timer, a
+      // task being written can not be of the removed file
+      ObSpinLockGuard guard(persist_lock_);
+      for (int64_t i = persist_tasks_.count() - 1; i >= 0; i--) {
+        if (file_id == persist_tasks_.at(i).file_id_) {
+          free_persist_task_(persist_tasks_.at(i));
+          (void)persist_tasks_.remove(i);
+        }
+      }
+    }
+    {
+      SpinWLockGuard guard(lock_);
+      (void)index_files_.erase_refactored(file_id, &index_file);
+    }
+    // queries take the read lock while using the index, none of them can see it now
+    free_index_file_(index_file);
+    if (0 != ::unlink(path) && ENOENT != errno) {
+      ret = OB_IO_ERROR;
+      CSR_LOG(WARN, "unlink mmap ilog index failed", K(ret), K(path), K(errno));
+    }
+  }
+  return ret;
+}
+}  // namespace clog
+}  // namespace oceanbase
@@ -0,0 +1,183 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_CLOG_OB_ILOG_MMAP_INDEX_H_
+#define OCEANBASE_CLOG_OB_ILOG_MMAP_INDEX_H_
+
+#include "lib/container/ob_se_array.h"
+#include "lib/hash/ob_hashmap.h"
+#include "lib/lock/ob_spin_lock.h"
+#include "lib/lock/ob_spin_rwlock.h"
+#include "common/ob_partition_key.h"
+#include "ob_log_define.h"
+
+namespace oceanbase {
+namespace clog {
+struct RawArray;
+
+// On-disk layout of the mmap ilog index, one file per old version ilog file:
+//
+//   | ObIlogMmapIndexHeader | ObIlogMmapPartitionEntry * partition_count | ObLogCursorExt * cursor_count |
+//
+// Partition entries are sorted by partition key, the cursors of one partition are
+// stored continuously and sorted by log id, so a query is a binary search on the
+// partition directory followed by an offset calculation on the cursor array.
+// The file is read through mmap, the page cache does the caching.
+//
+// The size and mtime of the ilog file the index was built from are recorded in the
+// header, an index whose ilog file was rebuilt or reused since is ignored.
+struct ObIlogMmapIndexHeader {
+  static const int64_t MAGIC = 0x494c4f474d4d4150;  // "ILOGMMAP"
+  static const int64_t VERSION = 2;
+
+  int64_t magic_;
+  int64_t version_;
+  int64_t file_id_;
+  int64_t partition_count_;
+  int64_t cursor_count_;
+  int64_t dir_offset_;
+  int64_t cursor_offset_;
+  int64_t dir_checksum_;
+  int64_t cursor_checksum_;
+  int64_t ilog_file_size_;
+  int64_t ilog_file_mtime_;
+
+  bool is_valid() const
+  {
+    return MAGIC == magic_ && VERSION == version_ && partition_count_ > 0 && cursor_count_ >= partition_count_ &&
+           dir_offset_ == static_cast<int64_t>(sizeof(ObIlogMmapIndexHeader)) && cursor_offset_ > dir_offset_;
+  }
+  TO_STRING_KV(K_(magic), K_(version), K_(file_id), K_(partition_count), K_(cursor_count), K_(dir_offset),
+      K_(cursor_offset), K_(dir_checksum), K_(cursor_checksum), K_(ilog_file_size), K_(ilog_file_mtime));
+};
+
+struct ObIlogMmapPartitionEntry {
+  uint64_t table_id_;
+  int64_t partition_id_;
+  int64_t partition_cnt_;
+  uint64_t min_log_id_;
+  uint64_t max_log_id_;
+  int64_t start_index_;
+
+  int compare(const common::ObPartitionKey& pkey) const;
+  TO_STRING_KV(K_(table_id), K_(partition_id), K_(partition_cnt), K_(min_log_id), K_(max_log_id), K_(start_index));
+};
+
+class ObIlogMmapIndexFile {
+public:
+  ObIlogMmapIndexFile();
+  ~ObIlogMmapIndexFile();
+
+public:
+  // ilog_file_size and ilog_file_mtime identify the ilog file the index must be built from
+  int open(const char* path, const int64_t ilog_file_size, const int64_t ilog_file_mtime);
+  void close();
+  // Return value:
+  // 1) OB_SUCCESS
+  // 2) OB_CURSOR_NOT_EXIST, partition or log id is not in this file
+  int get_cursor(const common::ObPartitionKey& pkey, const uint64_t query_log_id, ObGetCursorResult& result) const;
+  TO_STRING_KV(KP_(base), K_(size), K_(header));
+
+private:
+  int check_file_(const int64_t ilog_file_size, const int64_t ilog_file_mtime) const;
+  int search_partition_(const common::ObPartitionKey& pkey, const ObIlogMmapPartitionEntry*& entry) const;
+
+private:
+  char* base_;
+  int64_t size_;
+  ObIlogMmapIndexHeader header_;
+  const ObIlogMmapPartitionEntry* dir_;
+  const ObLogCursorExt* cursor_arr_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObIlogMmapIndexFile);
+};
+
+// Persists the sorted cursors of old version ilog files which were loaded by
+// ObIlogPerFileCacheBuilder, and serves later cursor queries on these files
+// directly from the mapped index instead of rebuilding ObIlogPerFileCache.
+//
+// The cache builder only copies the cursors into a persist task, the index files
+// are written by do_persist_tasks() in the ilog storage timer, so the query which
+// waits for the cache does not wait for the disk IO of the index.
+class ObIlogMmapIndexMgr {
+public:
+  ObIlogMmapIndexMgr();
+  ~ObIlogMmapIndexMgr();
+
+public:
+  int init(const char* ilog_dir);
+  void destroy();
+  // Return value:
+  // 1) OB_SUCCESS
+  // 2) OB_ENTRY_NOT_EXIST, no index file for file_id, caller should fallback to ObIlogCache
+  // 3) OB_CURSOR_NOT_EXIST
+  int get_cursor(const file_id_t file_id, const common::ObPartitionKey& pkey, const uint64_t query_log_id,
+      ObGetCursorResult& result);
+  // raw_array must be sorted by ilog_entry_comparator
+  // Return value:
+  // 1) OB_SUCCESS, the index of file_id will be written by do_persist_tasks()
+  // 2) OB_EAGAIN, too many persist tasks are pending
+  int persist(const file_id_t file_id, const RawArray& raw_array);
+  // write the index files of pending persist tasks, this is time-consumed
+  int do_persist_tasks();
+  int remove(const file_id_t file_id);
+
+private:
+  // partition directory and cursor array of one index file, dir_ and cursor_arr_ share one buffer
+  struct PersistTask {
+    file_id_t file_id_;
+    int64_t partition_count_;
+    int64_t cursor_count_;
+    ObIlogMmapPartitionEntry* dir_;
+    ObLogCursorExt* cursor_arr_;
+    TO_STRING_KV(K_(file_id), K_(partition_count), K_(cursor_count), KP_(dir), KP_(cursor_arr));
+  };
+  typedef common::hash::ObHashMap<file_id_t, ObIlogMmapIndexFile*, common::hash::NoPthreadDefendMode> IndexFileMap;
+  void trim_dir_suffix_(int64_t len);
+  int format_path_(const file_id_t file_id, const bool is_tmp, char* path, const int64_t size) const;
+  int stat_ilog_file_(const file_id_t file_id, int64_t& size, int64_t& mtime) const;
+  int get_cursor_(const file_id_t file_id, const common::ObPartitionKey& pkey, const uint64_t query_log_id,
+      ObGetCursorResult& result, bool& need_open);
+  // do file IO without lock, take the lock only to publish the opened index
+  int open_index_file_(const file_id_t file_id);
+  static int64_t count_partitions_(const RawArray& raw_array);
+  int build_partition_dir_(const RawArray& raw_array, ObIlogMmapPartitionEntry* dir, const int64_t dir_size,
+      int64_t& partition_count) const;
+  int build_persist_task_(const file_id_t file_id, const RawArray& raw_array, PersistTask& task) const;
+  int write_index_file_(const PersistTask& task);
+  void free_index_file_(ObIlogMmapIndexFile* index_file);
+  void free_persist_task_(PersistTask& task);
+  int check_persist_task_(const file_id_t file_id, bool& is_pending) const;
+  bool pop_persist_task_(PersistTask& task);
+  static int write_all_(const int fd, const char* buf, const int64_t len);
+  static const int64_t BUCKET_NUM = 1024;
+  static const int64_t INDEX_DIR_SUFFIX_LEN = 6;  // "_index"
+  // each pending task holds 32 bytes per cursor of an ilog file
+  static const int64_t MAX_PENDING_PERSIST_COUNT = 8;
+
+private:
+  bool is_inited_;
+  char ilog_dir_[common::MAX_PATH_SIZE];
+  char index_dir_[common::MAX_PATH_SIZE];
+  common::SpinRWLock lock_;
+  IndexFileMap index_files_;
+  common::ObSpinLock persist_lock_;
+  common::ObSEArray<PersistTask, MAX_PENDING_PERSIST_COUNT> persist_tasks_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObIlogMmapIndexMgr);
+};
+}  // namespace clog
+}  // namespace oceanbase
+
+#endif  // OCEANBASE_CLOG_OB_ILOG_MMAP_INDEX_H_
@@ -14,6 +14,8 @@
 #include "ob_raw_entry_iterator.h"
 #include "ob_file_id_cache.h"
 #include "ob_ilog_storage.h"
+#include "ob_ilog_mmap_index.h"
+#include "share/config/ob_server_config.h"
 
 namespace oceanbase {
 using namespace common;
@@ -205,7 +207,8 @@ int ObIlogPerFileCache::binary_search_timestamp_from_cursor_array_(const ObLogCu
   return ret;
 }
 
-int ObIlogPerFileCacheBuilder::init(ObIlogStorage* ilog_storage, ObFileIdCache* file_id_cache)
+int ObIlogPerFileCacheBuilder::init(
+    ObIlogStorage* ilog_storage, ObFileIdCache* file_id_cache, ObIlogMmapIndexMgr* mmap_index_mgr)
 {
   int ret = OB_SUCCESS;
   if (OB_UNLIKELY(NULL == ilog_storage) || OB_UNLIKELY(NULL == file_id_cache)) {
@@ -214,6 +217,7 @@ int ObIlogPerFileCacheBuilder::init(ObIlogStorage* ilog_storage, ObFileIdCache*
   } else {
     ilog_storage_ = ilog_storage;
     file_id_cache_ = file_id_cache;
+    mmap_index_mgr_ = mmap_index_mgr;
   }
   return ret;
 }
@@ -248,6 +252,15 @@ int ObIlogPerFileCacheBuilder::build_cache(
       } else {
         CSR_LOG(INFO, "[ILOG_PER_FILE_CACHE] build_cache success", K(ret), K(file_id), "entry_count", raw_array.count_);
       }
+      if (OB_SUCC(ret) && NULL != mmap_index_mgr_ && GCONF._enable_ilog_mmap_index) {
+        int tmp_ret = OB_SUCCESS;
+        // only copies the cursors, the index is written in background and serves later
+        // queries on this file, failure only means the file will be loaded into
+        // ObIlogCache again after being washed.
+        if (OB_SUCCESS != (tmp_ret = mmap_index_mgr_->persist(file_id, raw_array))) {
+          CSR_LOG(WARN, "[ILOG_PER_FILE_CACHE] persist mmap index failed", K(tmp_ret), K(file_id));
+        }
+      }
     } else {
       CSR_LOG(ERROR, "[ILOG_PER_FILE_CACHE] build_cache ilog raw_array count is 0", K(file_id), K(raw_array));
     }
@@ -21,6 +21,7 @@ namespace oceanbase {
 namespace clog {
 class ObIlogStorage;
 class ObIRawIndexIterator;
+class ObIlogMmapIndexMgr;
 
 // to buffer raw entries just read from ilog file
 struct RawArray {
@@ -87,15 +88,17 @@ int ilog_entry_comparator(const void* e1, const void* e2);
 
 class ObIlogPerFileCacheBuilder {
 public:
-  ObIlogPerFileCacheBuilder() : ilog_storage_(NULL), file_id_cache_(NULL)
+  ObIlogPerFileCacheBuilder() : ilog_storage_(NULL), file_id_cache_(NULL), mmap_index_mgr_(NULL)
   {}
 
 public:
-  int init(ObIlogStorage* ilog_storage, ObFileIdCache* file_id_cache);
+  // mmap_index_mgr is optional, the sorted cursors are persisted as mmap index if it is set
+  int init(ObIlogStorage* ilog_storage, ObFileIdCache* file_id_cache, ObIlogMmapIndexMgr* mmap_index_mgr = NULL);
   void destroy()
   {
     ilog_storage_ = NULL;
     file_id_cache_ = NULL;
+    mmap_index_mgr_ = NULL;
   }
   int build_cache(const file_id_t file_id, ObIlogPerFileCache* pf_cache, common::PageArena<>& pf_page_arena,
       ObIlogStorageQueryCost& csr_cost);
@@ -137,6 +140,7 @@ private:
 private:
   ObIlogStorage* ilog_storage_;
   ObFileIdCache* file_id_cache_;
+  ObIlogMmapIndexMgr* mmap_index_mgr_;
 };
 }  // namespace clog
 }  // namespace oceanbase
@@ -664,6 +664,8 @@ void ObIlogStorage::ObIlogStorageTimerTask::runTimerTask()
   wash_ilog_cache_();
   purge_stale_file_();
   purge_stale_ilog_index_();
+  // after purging, indexes of the purged ilog files are not written
+  persist_mmap_index_();
 }
 
 void ObIlogStorage::ObIlogStorageTimerTask::wash_ilog_cache_()
@@ -705,6 +707,19 @@ void ObIlogStorage::ObIlogStorageTimerTask::purge_stale_ilog_index_()
   }
 }
 
+void ObIlogStorage::ObIlogStorageTimerTask::persist_mmap_index_()
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(ilog_storage_)) {
+    ret = OB_ERR_UNEXPECTED;
+    CSR_LOG(WARN, "null ilog_storage", K(ret));
+  } else if (OB_FAIL(ilog_storage_->persist_mmap_index())) {
+    CSR_LOG(WARN, "ilog_storage_timer persist_mmap_index failed", K(ret));
+  } else {
+    CSR_LOG(TRACE, "ilog_storage_timer persist_mmap_index success");
+  }
+}
+
 ObIlogStorage::ObIlogStorage()
     : is_inited_(false),
       partition_service_(NULL),
@@ -712,6 +727,7 @@ ObIlogStorage::ObIlogStorage()
       ilog_store_(),
       pf_cache_builder_(),
       ilog_cache_(),
+      mmap_index_mgr_(),
       task_()
 {}
 
@@ -751,7 +767,9 @@ int ObIlogStorage::init(const char* dir_name, const int64_t server_seq, const co
   } else if (OB_FAIL(ilog_store_.init(
                  next_ilog_file_id, file_store_, &file_id_cache_, &direct_reader_, partition_service))) {
     CSR_LOG(ERROR, "ilog_store_ init failed", K(ret));
-  } else if (OB_FAIL(pf_cache_builder_.init(this, &file_id_cache_))) {
+  } else if (OB_FAIL(mmap_index_mgr_.init(dir_name))) {
+    CSR_LOG(ERROR, "mmap_index_mgr_ init failed", K(ret));
+  } else if (OB_FAIL(pf_cache_builder_.init(this, &file_id_cache_, &mmap_index_mgr_))) {
     CSR_LOG(ERROR, "pf_cache_builder_ init failed", K(ret));
   } else if (OB_FAIL(ilog_cache_.init(ilog_cache_config, &pf_cache_builder_))) {
     CSR_LOG(ERROR, "ilog_cache_ init failed", K(ret));
@@ -782,6 +800,7 @@ void ObIlogStorage::destroy()
   commit_log_env_ = NULL;
   ilog_store_.destroy();
   pf_cache_builder_.destroy();
+  mmap_index_mgr_.destroy();
   ilog_cache_.destroy();
   // tasks don't need to destory
   TG_DESTROY(lib::TGDefIDs::ILOGPurge);
@@ -1166,6 +1185,18 @@ int ObIlogStorage::wash_ilog_cache()
   return ret;
 }
 
+int ObIlogStorage::persist_mmap_index()
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    CSR_LOG(ERROR, "ObIlogStorage is not inited", K(ret));
+  } else if (OB_FAIL(mmap_index_mgr_.do_persist_tasks())) {
+    CSR_LOG(WARN, "mmap_index_mgr_ do_persist_tasks failed", K(ret));
+  }
+  return ret;
+}
+
 int ObIlogStorage::purge_stale_file()
 {
   int ret = OB_SUCCESS;
@@ -1403,6 +1434,10 @@ int ObIlogStorage::get_cursor_from_ilog_cache_(const common::ObPartitionKey& par
              !log2file_item.is_valid()) {
     ret = OB_INVALID_ARGUMENT;
     CSR_LOG(ERROR, "invalid arguments", K(ret), K(partition_key), K(query_log_id), K(log2file_item));
+  } else if (GCONF._enable_ilog_mmap_index &&
+             OB_ENTRY_NOT_EXIST !=
+                 (ret = get_cursor_from_mmap_index_(partition_key, query_log_id, log2file_item, result))) {
+    // served by mmap index, no need to load this file into ObIlogCache
   } else if (is_backfilled) {
     const uint64_t min_log_id = log2file_item.get_min_log_id();
     const uint64_t max_log_id = log2file_item.get_max_log_id();
@@ -1438,6 +1473,24 @@ int ObIlogStorage::get_cursor_from_ilog_cache_(const common::ObPartitionKey& par
   return ret;
 }
 
+int ObIlogStorage::get_cursor_from_mmap_index_(const common::ObPartitionKey& partition_key,
+    const uint64_t query_log_id, const Log2File& log2file_item, ObGetCursorResult& result)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(mmap_index_mgr_.get_cursor(log2file_item.get_file_id(), partition_key, query_log_id, result))) {
+    if (OB_ENTRY_NOT_EXIST != ret && OB_CURSOR_NOT_EXIST != ret) {
+      // the index is only an accelerator, let ObIlogCache serve the query
+      CSR_LOG(WARN, "mmap_index_mgr_ get_cursor failed, fallback to ObIlogCache", K(ret), K(partition_key),
+          K(query_log_id), K(log2file_item));
+      ret = OB_ENTRY_NOT_EXIST;
+    }
+  } else {
+    CSR_LOG(
+        TRACE, "mmap_index_mgr_ get_cursor success", K(partition_key), K(query_log_id), K(log2file_item), K(result));
+  }
+  return ret;
+}
+
 int ObIlogStorage::query_max_ilog_from_memstore_(const common::ObPartitionKey& partition_key, uint64_t& ret_max_ilog_id)
 {
   int ret = OB_SUCCESS;
@@ -1566,6 +1619,12 @@ int ObIlogStorage::do_purge_stale_ilog_file_(const file_id_t file_id)
     CSR_LOG(ERROR, "file_id_cache_ purge failed", K(ret), K(purge_strategy));
   } else if (OB_FAIL(file_store_->delete_file(file_id))) {
     CSR_LOG(WARN, "purge failed", K(ret), K(file_id), K(errno));
+  } else {
+    int tmp_ret = OB_SUCCESS;
+    // the ilog file is purged, a leftover index is ignored as it can not match any ilog file
+    if (OB_SUCCESS != (tmp_ret = mmap_index_mgr_.remove(file_id))) {
+      CSR_LOG(WARN, "remove mmap ilog index failed", K(tmp_ret), K(file_id));
+    }
   }
   return ret;
 }
@@ -16,6 +16,7 @@
 #include "lib/task/ob_timer.h"
 #include "ob_file_id_cache.h"
 #include "ob_ilog_cache.h"
+#include "ob_ilog_mmap_index.h"
 #include "ob_ilog_store.h"
 #include "ob_log_cache.h"
 #include "ob_log_define.h"
@@ -153,6 +154,7 @@ public:
   int wash_ilog_cache();
   int purge_stale_file();
   int purge_stale_ilog_index();
+  int persist_mmap_index();
   // for ObIlogPerFileCacheBuilder
   ObIRawIndexIterator* alloc_raw_index_iterator(
       const file_id_t start_file_id, const file_id_t end_file_id, const offset_t offset);
@@ -180,6 +182,7 @@ private:
     void wash_ilog_cache_();
     void purge_stale_file_();
     void purge_stale_ilog_index_();
+    void persist_mmap_index_();
 
   private:
     ObIlogStorage* ilog_storage_;
@@ -196,6 +199,12 @@ private:
       const Log2File& log2file_item, ObGetCursorResult& result);
   int get_cursor_from_ilog_cache_(const common::ObPartitionKey& partition_key, const uint64_t query_log_id,
       const Log2File& log2file_item, ObGetCursorResult& result);
+  // Return value:
+  // 1) OB_SUCCESS
+  // 2) OB_ENTRY_NOT_EXIST, no usable mmap index for this file, any error of the index is returned as this
+  // 3) OB_CURSOR_NOT_EXIST
+  int get_cursor_from_mmap_index_(const common::ObPartitionKey& partition_key, const uint64_t query_log_id,
+      const Log2File& log2file_item, ObGetCursorResult& result);
   int query_max_ilog_from_memstore_(const common::ObPartitionKey& partition_key, uint64_t& ret_max_ilog_id);
   int handle_locate_between_files_(
       const Log2File& prev_item, const Log2File& next_item, uint64_t& target_log_id, int64_t& target_log_timestamp);
@@ -220,6 +229,7 @@ private:
   ObIlogStore ilog_store_;
   ObIlogPerFileCacheBuilder pf_cache_builder_;
   ObIlogCache ilog_cache_;
+  ObIlogMmapIndexMgr mmap_index_mgr_;
   ObIlogStorageTimerTask task_;
 
 private:
@@ -151,6 +151,8 @@ void ObEliminateTask::runTimerTask()
   if (OB_SUCC(ret)) {
     int64_t start_time = obsys::CTimeUtil::getTime();
     int64_t evict_batch_count = 0;
+    // publish records staged by idle workers
+    request_manager_->flush_staged_records();
     // Eliminate by memory
     if (evict_high_level < allocator->allocated()) {
       LOG_INFO("sql audit evict mem start",
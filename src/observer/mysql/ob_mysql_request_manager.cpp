@@ -21,6 +21,7 @@
 #include "lib/stat/ob_session_stat.h"
 #include "lib/alloc/alloc_func.h"
 #include "lib/thread/thread_mgr.h"
+#include "lib/thread_local/ob_tsi_utils.h"
 #include "lib/rc/ob_rc.h"
 #include "share/rc/ob_context.h"
 #include "observer/mysql/ob_mysql_request_manager.h"
@@ -50,7 +51,9 @@ ObMySQLRequestManager::ObMySQLRequestManager()
       task_(),
       tenant_id_(OB_INVALID_TENANT_ID),
       tg_id_(-1)
-{}
+{
+  MEMSET(stage_slots_, 0, sizeof(stage_slots_));
+}
 
 ObMySQLRequestManager::~ObMySQLRequestManager()
 {
@@ -96,6 +99,13 @@ void ObMySQLRequestManager::destroy()
   if (!destroyed_) {
     TG_DESTROY(tg_id_);
     clear_queue();
+    for (int64_t i = 0; i < STAGE_SLOT_COUNT; i++) {
+      if (NULL != stage_slots_[i]) {
+        stage_slots_[i]->~StageSlot();
+        ob_free(stage_slots_[i]);
+        stage_slots_[i] = NULL;
+      }
+    }
     queue_.destroy();
     allocator_.destroy();
     inited_ = false;
@@ -123,6 +133,8 @@ int ObMySQLRequestManager::record_request(const ObAuditRecordData& audit_record,
   int ret = OB_SUCCESS;
   if (!inited_) {
     ret = OB_NOT_INIT;
+  } else if (is_sensitive || !need_record_(audit_record)) {
+    // sensitive or sampled out, skip copying it
   } else {
     ObMySQLRequestRecord* record = NULL;
     char* buf = NULL;
@@ -198,27 +210,128 @@ int ObMySQLRequestManager::record_request(const ObAuditRecordData& audit_record,
             audit_record.exec_timestamp_.receive_ts_);
       }
 
-      // push into queue
+      // stage it, published into queue in batch
       if (OB_SUCC(ret)) {
-        int64_t req_id = 0;
-        if (is_sensitive) {
-          free(record);
-          record = NULL;
-        } else if (OB_FAIL(queue_.push(record, req_id))) {
+        if (OB_FAIL(stage_record_(record))) {
           if (REACH_TIME_INTERVAL(2 * 1000 * 1000)) {
             SERVER_LOG(WARN, "push into queue failed", K(ret));
           }
-          free(record);
-          record = NULL;
-        } else {
-          record->data_.request_id_ = req_id;
         }
+        record = NULL;
+      } else {
+        free(record);
+        record = NULL;
       }
     }
   }  // end
   return ret;
 }
 
+// When _sql_audit_sample_ratio is less than 100, only part of the normal requests
+// are recorded, failed requests and slow requests are always recorded.
+bool ObMySQLRequestManager::need_record_(const ObAuditRecordData& audit_record) const
+{
+  bool bret = true;
+  const int64_t sample_ratio = GCONF._sql_audit_sample_ratio;
+  if (sample_ratio >= 100) {
+    // record all
+  } else if (OB_SUCCESS != audit_record.status_) {
+    // always keep errored request
+  } else if (audit_record.get_elapsed_time() >= GCONF.trace_log_slow_query_watermark) {
+    // always keep slow request
+  } else {
+    static __thread uint64_t sample_seq = 0;
+    bret = static_cast<int64_t>(sample_seq++ % 100) < sample_ratio;
+  }
+  return bret;
+}
+
+// Only the thread owning the thread index allocates its slot, flush_staged_records() may
+// read it concurrently.
+int ObMySQLRequestManager::get_stage_slot_(StageSlot*& slot)
+{
+  int ret = OB_SUCCESS;
+  const int64_t itid = get_itid();
+  slot = NULL;
+  if (OB_UNLIKELY(itid < 0 || itid >= STAGE_SLOT_COUNT)) {
+    // no slot for this thread, its records are pushed one by one
+  } else if (NULL == (slot = ATOMIC_LOAD(&stage_slots_[itid]))) {
+    void* buf = NULL;
+    ObMemAttr attr(tenant_id_, ObModIds::OB_MYSQL_REQUEST_RECORD);
+    if (NULL == (buf = ob_malloc(sizeof(StageSlot), attr))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      SERVER_LOG(WARN, "failed to alloc stage slot", K(ret), K(itid));
+    } else {
+      slot = new (buf) StageSlot();
+      ATOMIC_STORE(&stage_slots_[itid], slot);
+    }
+  }
+  return ret;
+}
+
+int ObMySQLRequestManager::stage_record_(ObMySQLRequestRecord* record)
+{
+  int ret = OB_SUCCESS;
+  StageSlot* slot = NULL;
+  if (OB_FAIL(get_stage_slot_(slot))) {
+    free(record);
+  } else if (NULL == slot) {
+    int64_t req_id = 0;
+    if (OB_FAIL(queue_.push(record, req_id))) {
+      free(record);
+    } else {
+      record->data_.request_id_ = req_id;
+    }
+  } else {
+    const int64_t cur_ts = ObTimeUtility::current_time();
+    ObSpinLockGuard guard(slot->lock_);
+    if (0 == slot->count_) {
+      slot->first_stage_ts_ = cur_ts;
+    }
+    slot->records_[slot->count_++] = record;
+    if (slot->count_ >= STAGE_BATCH_SIZE || cur_ts - slot->first_stage_ts_ >= MAX_STAGE_TIME) {
+      ret = publish_stage_slot_(*slot);
+    }
+  }
+  return ret;
+}
+
+// caller must hold slot.lock_
+int ObMySQLRequestManager::publish_stage_slot_(StageSlot& slot)
+{
+  int ret = OB_SUCCESS;
+  int64_t start_seq = 0;
+  if (slot.count_ <= 0) {
+    // do nothing
+  } else if (OB_FAIL(queue_.push_batch(reinterpret_cast<void**>(slot.records_), slot.count_, start_seq))) {
+    for (int64_t i = 0; i < slot.count_; i++) {
+      free(slot.records_[i]);
+      slot.records_[i] = NULL;
+    }
+  } else {
+    for (int64_t i = 0; i < slot.count_; i++) {
+      slot.records_[i]->data_.request_id_ = start_seq + i;
+      slot.records_[i] = NULL;
+    }
+  }
+  slot.count_ = 0;
+  return ret;
+}
+
+void ObMySQLRequestManager::flush_staged_records()
+{
+  int ret = OB_SUCCESS;
+  for (int64_t i = 0; i < STAGE_SLOT_COUNT; i++) {
+    StageSlot* slot = ATOMIC_LOAD(&stage_slots_[i]);
+    if (NULL != slot && ATOMIC_LOAD(&slot->count_) > 0) {
+      ObSpinLockGuard guard(slot->lock_);
+      if (OB_FAIL(publish_stage_slot_(*slot))) {
+        SERVER_LOG(DEBUG, "publish staged records failed", K(ret), K(i));
+      }
+    }
+  }
+}
+
 int ObMySQLRequestManager::get_mem_limit(uint64_t tenant_id, int64_t& mem_limit)
 {
   int ret = OB_SUCCESS;
@@ -16,6 +16,7 @@
 #include "share/ob_define.h"
 #include "lib/string/ob_string.h"
 #include "lib/atomic/ob_atomic.h"
+#include "lib/lock/ob_spin_lock.h"
 #include "lib/stat/ob_diagnose_info.h"
 #include "observer/mysql/ob_mysql_result_set.h"
 #include "share/config/ob_server_config.h"
@@ -79,6 +80,12 @@ public:
   static const int64_t LOW_LEVEL_EVICT_SIZE = 8000000;  // 800w
   // interval between elimination
   static const int64_t EVICT_INTERVAL = 1000000;  // 1s
+  // records are staged per worker thread and published to queue in batch, one slot per thread index,
+  // allocated when the thread records its first request
+  static const int64_t STAGE_SLOT_COUNT = common::OB_MAX_THREAD_NUM;
+  static const int64_t STAGE_BATCH_SIZE = 16;
+  // max time a record stays in stage before the next record of the same slot publishes it
+  static const int64_t MAX_STAGE_TIME = 100 * 1000;  // 100ms
   typedef common::ObRaQueue::Ref Ref;
 
 public:
@@ -104,6 +111,8 @@ public:
   }
 
   int record_request(const ObAuditRecordData& audit_record, bool is_sensitive = false);
+  // publish all staged records, called by eliminate task and before scanning sql_audit
+  void flush_staged_records();
 
   int64_t get_start_idx() const
   {
@@ -164,6 +173,7 @@ public:
 
   void clear_queue()
   {
+    flush_staged_records();
     (void)release_old(INT64_MAX);
   }
 
@@ -180,6 +190,18 @@ public:
   static int get_mem_limit(uint64_t tenant_id, int64_t& mem_limit);
 
 private:
+  struct StageSlot {
+    StageSlot() : lock_(), count_(0), first_stage_ts_(0)
+    {}
+    common::ObSpinLock lock_;
+    int64_t count_;
+    int64_t first_stage_ts_;
+    ObMySQLRequestRecord* records_[STAGE_BATCH_SIZE];
+  };
+  bool need_record_(const ObAuditRecordData& audit_record) const;
+  int get_stage_slot_(StageSlot*& slot);
+  int stage_record_(ObMySQLRequestRecord* record);
+  int publish_stage_slot_(StageSlot& slot);
   DISALLOW_COPY_AND_ASSIGN(ObMySQLRequestManager);
 
 private:
@@ -190,6 +212,7 @@ private:
   common::ObConcurrentFIFOAllocator allocator_;  // alloc mem for string buf
   common::ObRaQueue queue_;
   ObEliminateTask task_;
+  StageSlot* stage_slots_[STAGE_SLOT_COUNT];
 
   // tenant id of this request manager
   uint64_t tenant_id_;
@@ -138,6 +138,38 @@ public:
     }
     return ret;
   }
+  // reserve count continuous slots with one CAS, all or nothing
+  int push_batch(void** p, const int64_t count, int64_t& start_seq)
+  {
+    int ret = OB_SUCCESS;
+    if (NULL == array_) {
+      ret = OB_NOT_INIT;
+    } else if (NULL == p || count <= 0 || count > (int64_t)capacity_) {
+      ret = OB_INVALID_ARGUMENT;
+    } else {
+      bool reserved = false;
+      uint64_t push_idx = ATOMIC_LOAD(&push_);
+      while (!reserved && push_idx + count <= ATOMIC_LOAD(&pop_) + capacity_) {
+        uint64_t ov = push_idx;
+        if (ov == (push_idx = ATOMIC_VCAS(&push_, ov, ov + count))) {
+          reserved = true;
+        } else {
+          PAUSE();
+        }
+      }
+      if (reserved) {
+        for (int64_t i = 0; i < count; i++) {
+          void** addr = get_addr(push_idx + i);
+          while (!ATOMIC_BCAS(addr, NULL, p[i]))
+            ;
+        }
+        start_seq = push_idx;
+      } else {
+        ret = OB_ENTRY_NOT_EXIST;
+      }
+    }
+    return ret;
+  }
   void* get(uint64_t seq, Ref* ref)
   {
     void* ret = NULL;
@@ -335,25 +335,226 @@ int ObMPQuery::process()
   return (OB_SUCCESS != ret) ? ret : tmp_ret;
 }
 
+// Only update supports batched multi-stmt, which is known after fast parsing all the queries and
+// parsing the first one. Check the leading keyword to skip that work for other packets, e.g. inserts.
+// Be conservative: anything not starting with a plain keyword, e.g. a comment, may be an update.
+static bool may_be_update_stmt(const ObString& query)
+{
+  const char* p = query.ptr();
+  const char* end = p + query.length();
+  bool bret = true;
+  while (p < end && isspace(static_cast<unsigned char>(*p))) {
+    ++p;
+  }
+  if (p < end && isalpha(static_cast<unsigned char>(*p))) {
+    const char* word_end = p;
+    while (word_end < end && isalpha(static_cast<unsigned char>(*word_end))) {
+      ++word_end;
+    }
+    bret = (6 == word_end - p && 0 == strncasecmp(p, "update", 6));
+  }
+  return bret;
+}
+
+static inline bool is_ident_char(const char c)
+{
+  return isalnum(static_cast<unsigned char>(c)) || '_' == c || '$' == c || 0 != (c & 0x80);
+}
+
+static inline bool is_comment_start(const char* p, const char* end)
+{
+  return '#' == *p || (p + 1 < end && (('-' == p[0] && '-' == p[1]) || ('/' == p[0] && '*' == p[1])));
+}
+
+// Skip the quoted string or identifier starting at %p, NULL if it is not closed. A backslash is
+// not accepted since whether it escapes the quote depends on NO_BACKSLASH_ESCAPES.
+static const char* skip_quoted(const char* p, const char* end)
+{
+  const char quote = *p++;
+  while (p < end && quote != *p && '\\' != *p) {
+    ++p;
+  }
+  return (p < end && quote == *p) ? p + 1 : NULL;
+}
+
+// Only what is sure to keep its meaning once the rows are put together is split: no comments,
+// no INSERT ... SELECT/SET and nothing after the rows, e.g. ON DUPLICATE KEY UPDATE.
+bool ObMPQuery::split_insert_values(const ObString& query, ObString& prefix, ObString& rows)
+{
+  bool bret = false;
+  const char* begin = query.ptr();
+  const char* end = begin + query.length();
+  const char* values_end = NULL;
+  const char* rows_begin = NULL;
+  const char* rows_end = NULL;
+  int64_t depth = 0;
+  while (begin < end && isspace(static_cast<unsigned char>(*begin))) {
+    ++begin;
+  }
+  while (end > begin && (isspace(static_cast<unsigned char>(end[-1])) || ';' == end[-1])) {
+    --end;
+  }
+  if (end - begin > 6 && 0 == strncasecmp(begin, "insert", 6) && !is_ident_char(begin[6])) {
+    bret = true;
+    const char* p = begin + 6;
+    // find VALUES outside any parenthesis
+    while (bret && NULL == values_end && p < end) {
+      if ('\'' == *p || '"' == *p || '`' == *p) {
+        bret = (NULL != (p = skip_quoted(p, end)));
+      } else if (is_comment_start(p, end)) {
+        bret = false;
+      } else if (is_ident_char(*p)) {
+        const char* word = p;
+        while (p < end && is_ident_char(*p)) {
+          ++p;
+        }
+        const int64_t word_len = p - word;
+        if (0 != depth) {
+        } else if ((6 == word_len && 0 == strncasecmp(word, "values", 6)) ||
+                   (5 == word_len && 0 == strncasecmp(word, "value", 5))) {
+          values_end = p;
+        } else if ((6 == word_len && 0 == strncasecmp(word, "select", 6)) ||
+                   (3 == word_len && 0 == strncasecmp(word, "set", 3))) {
+          bret = false;
+        }
+      } else {
+        depth += ('(' == *p) ? 1 : 0;
+        depth -= (')' == *p) ? 1 : 0;
+        ++p;
+      }
+    }
+    // the rows are parenthesized and separated by commas
+    bool need_row = true;
+    bret = bret && NULL != values_end && 0 == depth;
+    while (bret && p < end) {
+      if (isspace(static_cast<unsigned char>(*p))) {
+        ++p;
+      } else if (0 == depth) {
+        if (need_row && '(' == *p) {
+          rows_begin = (NULL == rows_begin) ? p : rows_begin;
+          need_row = false;
+          depth = 1;
+          ++p;
+        } else if (!need_row && ',' == *p) {
+          need_row = true;
+          ++p;
+        } else {
+          bret = false;
+        }
+      } else if ('\'' == *p || '"' == *p || '`' == *p) {
+        bret = (NULL != (p = skip_quoted(p, end)));
+      } else if (is_comment_start(p, end)) {
+        bret = false;
+      } else {
+        depth += ('(' == *p) ? 1 : 0;
+        depth -= (')' == *p) ? 1 : 0;
+        rows_end = (0 == depth) ? p + 1 : rows_end;
+        ++p;
+      }
+    }
+    bret = bret && !need_row && 0 == depth;
+  }
+  if (bret) {
+    prefix.assign_ptr(begin, static_cast<ObString::obstr_size_t>(values_end - begin));
+    rows.assign_ptr(rows_begin, static_cast<ObString::obstr_size_t>(rows_end - rows_begin));
+  }
+  return bret;
+}
+
+int ObMPQuery::merge_insert_stmts(
+    const ObIArray<ObString>& queries, ObIAllocator& allocator, ObString& merged_sql, bool& is_merged)
+{
+  int ret = OB_SUCCESS;
+  ObString first_prefix;
+  ObString prefix;
+  ObString rows;
+  ObSEArray<ObString, 16> rows_array;
+  int64_t merged_len = 0;
+  is_merged = queries.count() > 1;
+  for (int64_t i = 0; OB_SUCC(ret) && is_merged && i < queries.count(); ++i) {
+    if (!split_insert_values(queries.at(i), prefix, rows)) {
+      is_merged = false;
+    } else if (0 != i && prefix != first_prefix) {
+      is_merged = false;
+    } else if (OB_FAIL(rows_array.push_back(rows))) {
+      LOG_WARN("failed to push back rows", K(ret));
+    } else {
+      first_prefix = (0 == i) ? prefix : first_prefix;
+      merged_len += rows.length() + 1;
+    }
+  }
+  if (OB_SUCC(ret) && is_merged) {
+    char* buf = NULL;
+    int64_t pos = 0;
+    merged_len += first_prefix.length();
+    if (OB_ISNULL(buf = static_cast<char*>(allocator.alloc(merged_len)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to alloc merged sql", K(ret), K(merged_len));
+    } else {
+      MEMCPY(buf, first_prefix.ptr(), first_prefix.length());
+      pos += first_prefix.length();
+      for (int64_t i = 0; i < rows_array.count(); ++i) {
+        buf[pos++] = (0 == i) ? ' ' : ',';
+        MEMCPY(buf + pos, rows_array.at(i).ptr(), rows_array.at(i).length());
+        pos += rows_array.at(i).length();
+      }
+      merged_sql.assign_ptr(buf, static_cast<ObString::obstr_size_t>(pos));
+    }
+  }
+  if (OB_FAIL(ret)) {
+    is_merged = false;
+  }
+  return ret;
+}
+
 /*
- * Try to evaluate multiple update queries as a single query to optimize rpc cost
+ * Try to evaluate multiple update queries as a single query to optimize rpc cost,
+ * or run inserts into the same table as a single multi-row insert.
  */
 int ObMPQuery::try_batched_multi_stmt_optimization(sql::ObSQLSessionInfo& session, common::ObIArray<ObString>& queries,
     const ObMPParseStat& parse_stat, bool& optimization_done, bool& async_resp_used, bool& need_disconnect)
 {
   int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
   bool has_more = false;
   bool force_sync_resp = true;
   bool enable_batch_opt = false;
+  bool all_updates = true;
   optimization_done = false;
   if (queries.count() <= 1 || parse_stat.parse_fail_ || GET_MIN_CLUSTER_VERSION() < CLUSTER_VERSION_2230) {
     /*do nothing*/
   } else {
     // avoid holding the read latch when generating query plan
     enable_batch_opt = session.is_enable_batched_multi_statement();
+    for (int64_t i = 0; enable_batch_opt && all_updates && i < queries.count(); ++i) {
+      all_updates = may_be_update_stmt(queries.at(i));
+    }
   }
   if (!enable_batch_opt) {
     // do nothing
+  } else if (!all_updates) {
+    // The merged insert parses, gets the plan and starts the statement once for all the rows.
+    // Like the batched update it is a single statement: all the rows or none are inserted and
+    // one OK packet carries the affected rows of the packet.
+    ObString merged_sql;
+    bool is_merged = false;
+    if (OB_SUCCESS !=
+        (tmp_ret = merge_insert_stmts(queries, THIS_WORKER.get_sql_arena_allocator(), merged_sql, is_merged))) {
+      LOG_WARN("failed to merge insert stmts, execute them one by one", K(tmp_ret));
+    } else if (!is_merged) {
+      // do nothing
+    } else {
+      // the merged insert has responded even if it failed, never execute the queries again
+      optimization_done = true;
+      if (OB_FAIL(process_single_stmt(ObMultiStmtItem(false, 0, merged_sql),
+              session,
+              has_more,
+              force_sync_resp,
+              async_resp_used,
+              need_disconnect))) {
+        LOG_WARN("failed to process merged insert stmt", K(ret));
+      }
+    }
   } else if (OB_FAIL(process_single_stmt(ObMultiStmtItem(false, 0, sql_, &queries),
                  session,
                  has_more,
@@ -369,8 +570,11 @@ int ObMPQuery::try_batched_multi_stmt_optimization(sql::ObSQLSessionInfo& sessio
   } else {
     optimization_done = true;
   }
-  LOG_TRACE(
-      "succeed to try batched multi-stmt optimization", K(optimization_done), K(queries.count()), K(enable_batch_opt));
+  LOG_TRACE("succeed to try batched multi-stmt optimization",
+      K(optimization_done),
+      K(queries.count()),
+      K(enable_batch_opt),
+      K(all_updates));
   return ret;
 }
 
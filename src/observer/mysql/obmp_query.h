@@ -102,6 +102,12 @@ public:
     return is_com_filed_list_;
   }
 
+  // Split a plain "INSERT ... VALUES (...)[, (...)]" into the text up to VALUES and the row list.
+  static bool split_insert_values(const common::ObString& query, common::ObString& prefix, common::ObString& rows);
+  // Merge inserts sharing the text up to VALUES into one multi-row insert.
+  static int merge_insert_stmts(const common::ObIArray<common::ObString>& queries, common::ObIAllocator& allocator,
+      common::ObString& merged_sql, bool& is_merged);
+
 protected:
   int process() override;
   int deserialize() override;
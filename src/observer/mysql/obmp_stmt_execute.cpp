@@ -386,11 +386,8 @@ int ObMPStmtExecute::before_process()
       ObCharsetType charset = CHARSET_INVALID;
       ObCollationType cs_conn = CS_TYPE_INVALID;
       ObCollationType cs_server = CS_TYPE_INVALID;
-      share::schema::ObSchemaGetterGuard schema_guard;
-      const uint64_t tenant_id = session->get_effective_tenant_id();
-      if (OB_FAIL(gctx_.schema_service_->get_tenant_schema_guard(tenant_id, schema_guard))) {
-        LOG_WARN("get schema guard failed", K(ret));
-      } else if (OB_FAIL(session->get_character_set_connection(charset))) {
+      // decoding params needs no schema, the schema guard is taken once in do_process_single()
+      if (OB_FAIL(session->get_character_set_connection(charset))) {
         LOG_WARN("get charset for client failed", K(ret));
       } else if (OB_FAIL(session->get_collation_connection(cs_conn))) {
         LOG_WARN("get charset for client failed", K(ret));
@@ -414,9 +411,7 @@ int ObMPStmtExecute::before_process()
       }
       if (OB_SUCC(ret)) {
         LOG_TRACE("ps session info", K(ret), "session_id", session->get_sessid(), K(*ps_session_info));
-        share::schema::ObSchemaGetterGuard* old_guard = ctx_.schema_guard_;
         ObSQLSessionInfo* old_sess_info = ctx_.session_info_;
-        ctx_.schema_guard_ = &schema_guard;
         ctx_.session_info_ = session;
         const int64_t params_num_ = ps_session_info->get_param_count();
         stmt_type_ = ps_session_info->get_stmt_type();
@@ -530,7 +525,6 @@ int ObMPStmtExecute::before_process()
             }
           }  // for end
         }
-        ctx_.schema_guard_ = old_guard;
         ctx_.session_info_ = old_sess_info;
       }
     }
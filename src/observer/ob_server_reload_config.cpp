@@ -109,6 +109,7 @@ int ObServerReloadConfig::operator()()
     io_config.disk_io_thread_count_ = GCONF.disk_io_thread_count;
     io_config.callback_thread_count_ = GCONF._io_callback_thread_count;
     io_config.large_query_io_percent_ = GCONF._large_query_io_percentage;
+    io_config.tmp_file_io_percent_ = GCONF._temporary_file_io_percentage;
     // In the 2.x version, reuse the sys_bkgd_io_timeout configuration item to indicate the data disk io timeout time
     // After version 3.1, use the data_storage_io_timeout configuration item.
     io_config.data_storage_io_timeout_ms_ = GCONF._data_storage_io_timeout / 1000L;
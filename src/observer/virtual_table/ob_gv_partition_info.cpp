@@ -14,6 +14,8 @@
 #include "observer/ob_server.h"
 #include "storage/ob_partition_group.h"
 #include "storage/ob_partition_service.h"
+#include "storage/ob_table_store_stat_mgr.h"
+#include "storage/memtable/ob_memtable.h"
 
 using namespace oceanbase::common;
 using namespace oceanbase::storage;
@@ -196,10 +198,15 @@ int ObGVPartitionInfo::inner_get_next_row(ObNewRow*& row)
           }
           break;
         }
-        case OB_APP_MIN_COLUMN_ID + 10:
+        case OB_APP_MIN_COLUMN_ID + 10: {
           // ('sstable_read_count_15_minute_rate', 'double'),
-          cur_row_.cells_[i].set_double(0);
+          double read_rate = 0;
+          if (OB_SUCCESS != (tmp_ret = get_read_rate(*partition, read_rate))) {
+            SERVER_LOG(WARN, "failed to get read rate", K(tmp_ret), K(pkey));
+          }
+          cur_row_.cells_[i].set_double(read_rate);
           break;
+        }
         case OB_APP_MIN_COLUMN_ID + 11:
           // ('sstable_read_bytes_15_minute_rate', 'double'),
           cur_row_.cells_[i].set_double(0);
@@ -220,10 +227,15 @@ int ObGVPartitionInfo::inner_get_next_row(ObNewRow*& row)
           // ('log_write_bytes_15_minute_rate', 'double'),
           cur_row_.cells_[i].set_double(0);
           break;
-        case OB_APP_MIN_COLUMN_ID + 16:
+        case OB_APP_MIN_COLUMN_ID + 16: {
           // ('memtable_bytes', 'int'),
-          cur_row_.cells_[i].set_int(static_cast<int64_t>(0));
+          int64_t memtable_bytes = 0;
+          if (OB_SUCCESS != (tmp_ret = get_memtable_bytes(*partition, memtable_bytes))) {
+            SERVER_LOG(WARN, "failed to get memtable bytes", K(tmp_ret), K(pkey));
+          }
+          cur_row_.cells_[i].set_int(memtable_bytes);
           break;
+        }
         case OB_APP_MIN_COLUMN_ID + 17:
           // ('cpu_utime_15_minute_rate', 'double'),
           cur_row_.cells_[i].set_double(0);
@@ -327,5 +339,57 @@ int ObGVPartitionInfo::inner_get_next_row(ObNewRow*& row)
   return ret;
 }
 
+// the read rate of a partition group is the sum of the disk reads per second of its partitions
+int ObGVPartitionInfo::get_read_rate(ObIPartitionGroup& partition, double& read_rate)
+{
+  int ret = OB_SUCCESS;
+  ObPartitionArray pkeys;
+  read_rate = 0;
+  if (OB_FAIL(partition.get_all_pg_partition_keys(pkeys))) {
+    SERVER_LOG(WARN, "failed to get all pg partition keys", K(ret));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < pkeys.count(); ++i) {
+      const ObTableStoreStatKey key(pkeys.at(i).get_table_id(), pkeys.at(i).get_partition_id());
+      double partition_read_rate = 0;
+      if (OB_FAIL(ObTableStoreStatMgr::get_instance().get_io_rate(key, partition_read_rate))) {
+        if (OB_HASH_NOT_EXIST == ret) {
+          ret = OB_SUCCESS;
+        } else {
+          SERVER_LOG(WARN, "failed to get read rate", K(ret), K(key));
+        }
+      } else {
+        read_rate += partition_read_rate;
+      }
+    }
+  }
+  return ret;
+}
+
+int ObGVPartitionInfo::get_memtable_bytes(ObIPartitionGroup& partition, int64_t& memtable_bytes)
+{
+  int ret = OB_SUCCESS;
+  ObTableHandle handle;
+  memtable::ObMemtable* memtable = NULL;
+  memtable_bytes = 0;
+  if (!ObReplicaTypeCheck::is_replica_with_memstore(partition.get_replica_type())) {
+    // no memtable
+  } else if (OB_FAIL(partition.get_pg_storage().get_active_memtable(handle))) {
+    if (OB_ENTRY_NOT_EXIST == ret) {
+      // replica which is being migrated in
+      ret = OB_SUCCESS;
+    } else {
+      SERVER_LOG(WARN, "failed to get active memtable", K(ret));
+    }
+  } else if (OB_FAIL(handle.get_memtable(memtable))) {
+    SERVER_LOG(WARN, "failed to get memtable", K(ret), K(handle));
+  } else if (OB_ISNULL(memtable)) {
+    ret = OB_ERR_UNEXPECTED;
+    SERVER_LOG(WARN, "memtable is NULL", K(ret));
+  } else {
+    memtable_bytes = memtable->get_occupied_size();
+  }
+  return ret;
+}
+
 }  // namespace observer
 }  // namespace oceanbase
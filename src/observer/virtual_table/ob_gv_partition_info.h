@@ -41,6 +41,8 @@ public:
 private:
   int freeze_status_to_string(int64_t freeze_status, char* buf, int64_t buf_len);
   int partition_state_to_string(int64_t partition_state, char* buf, int16_t buf_len);
+  int get_read_rate(storage::ObIPartitionGroup& partition, double& read_rate);
+  int get_memtable_bytes(storage::ObIPartitionGroup& partition, int64_t& memtable_bytes);
 
 private:
   storage::ObPartitionService* partition_service_;
@@ -244,6 +244,7 @@ int ObGvSqlAudit::inner_get_next_row(common::ObNewRow*& row)
               SERVER_LOG(DEBUG, "invalid query range for sql audit", K(t_id), K(key_ranges_));
               ret = OB_ITER_END;
             } else {
+              cur_mysql_req_mgr_->flush_staged_records();
               int64_t start_idx = cur_mysql_req_mgr_->get_start_idx();
               int64_t end_idx = cur_mysql_req_mgr_->get_end_idx();
               start_id_ = MAX(start_id_, start_idx);
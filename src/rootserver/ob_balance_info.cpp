@@ -1735,6 +1735,69 @@ int TenantBalanceStat::fill_tablegroups()
   return ret;
 }
 
+// Replicas of a partition group are reported by the pg key, their load is put on the first partition of the pg.
+int TenantBalanceStat::fill_replica_load()
+{
+  int ret = OB_SUCCESS;
+  ObReplicaStatIterator iter;
+  ObReplicaStat replica_stat;
+  PartitionMap pg_partition_map;
+  if (!inited_) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (GCONF._balancer_load_tolerance_percentage >= 100) {
+    // read load is not balanced, skip querying all observers
+  } else if (OB_ISNULL(sql_proxy_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("sql proxy is null", K(ret));
+  } else if (OB_FAIL(pg_partition_map.create(10240LL, ObModIds::OB_REBALANCE_TASK_MGR))) {
+    LOG_WARN("fail to create pg partition map", K(ret));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < all_partition_.count(); ++i) {
+      const Partition& p = all_partition_.at(i);
+      if (is_new_tablegroup_id(p.tablegroup_id_)) {
+        const ObPartitionKey pg_key(p.tablegroup_id_, p.partition_id_, 0);
+        if (OB_FAIL(pg_partition_map.set_refactored(pg_key, i))) {
+          if (OB_HASH_EXIST == ret) {
+            ret = OB_SUCCESS;
+          } else {
+            LOG_WARN("fail to set pg partition", K(ret), K(pg_key));
+          }
+        }
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(iter.init(*sql_proxy_))) {
+      LOG_WARN("fail to init replica stat iterator", K(ret));
+    } else if (OB_FAIL(iter.open(tenant_id_, all_replica_.count()))) {
+      LOG_WARN("fail to open replica stat iterator", K(ret), K_(tenant_id));
+    }
+    while (OB_SUCC(ret)) {
+      int64_t partition_idx = -1;
+      if (OB_FAIL(iter.next(replica_stat))) {
+        if (OB_ITER_END != ret) {
+          LOG_WARN("fail to get next replica stat", K(ret));
+        }
+      } else if (OB_SUCCESS == partition_map_.get_refactored(replica_stat.part_key_, partition_idx) ||
+                 OB_SUCCESS == pg_partition_map.get_refactored(replica_stat.part_key_, partition_idx)) {
+        Partition& p = all_partition_.at(partition_idx);
+        FOR_BEGIN_END(r, p, all_replica_)
+        {
+          if (NULL != r->server_ && r->server_->server_ == replica_stat.server_) {
+            r->load_factor_.set_resource_usage(replica_stat);
+          }
+        }
+      } else {
+        // partition created or dropped after the partition table is read
+      }
+    }
+    if (OB_ITER_END == ret) {
+      ret = OB_SUCCESS;
+    }
+  }
+  return ret;
+}
+
 int TenantBalanceStat::calc_load()
 {
   int ret = OB_SUCCESS;
@@ -2192,8 +2255,15 @@ int TenantBalanceStat::gather_stat(const uint64_t tenant_id, ObSchemaGetterGuard
       LOG_WARN("balancer stop", K(ret));
     } else if (OB_FAIL(update_partition_statistics())) {
       LOG_WARN("update statistics failed", K(ret));
-    } else if (OB_FAIL(calc_load())) {
-      LOG_WARN("failed to calc unit load", K(ret));
+    } else {
+      int tmp_ret = OB_SUCCESS;
+      // balance by disk only if the load can not be collected
+      if (OB_SUCCESS != (tmp_ret = fill_replica_load())) {
+        LOG_WARN("fail to fill replica load", K(tmp_ret), K_(tenant_id));
+      }
+      if (OB_FAIL(calc_load())) {
+        LOG_WARN("failed to calc unit load", K(ret));
+      }
     }
   }
 
@@ -3723,6 +3793,36 @@ int TenantBalanceStat::get_partition_group_data_size(
   return ret;
 }
 
+int TenantBalanceStat::get_partition_group_iops(
+    const common::ObZone& zone, const int64_t all_tg_idx, const int64_t part_idx, double& iops)
+{
+  int ret = OB_SUCCESS;
+  if (all_tg_idx < 0 || all_tg_idx >= all_tg_.count()) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(all_tg_idx), "total", all_tg_.count(), K(ret));
+  } else {
+    bool found = false;
+    iops = 0;
+    TableGroup& tg = all_tg_.at(all_tg_idx);
+    FOR_BEGIN_END_E(pg, tg, all_pg_, !found)
+    {
+      if (pg->partition_idx_ == part_idx) {
+        FOR_BEGIN_END(p, *pg, sorted_partition_)
+        {
+          FOR_BEGIN_END(r, **p, all_replica_)
+          {
+            if (r->zone_ == zone) {
+              iops += r->load_factor_.get_iops_usage();
+            }
+          }
+        }
+        found = true;
+      }
+    }
+  }
+  return ret;
+}
+
 int TenantBalanceStat::get_partition_entity_ids_by_tg_idx(
     const int64_t tablegroup_idx, common::ObIArray<uint64_t>& tids)
 {
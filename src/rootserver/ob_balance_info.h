@@ -148,6 +148,11 @@ public:
     disk_used_ = disk_used;
   }
   void set_resource_usage(ObReplicaStat& replica_stat);
+  // planned migrations move the io load of replicas, it is accounted as read load
+  void add_iops_usage(const double iops)
+  {
+    sstable_read_rate_ += iops;
+  }
   // for resource usage
   double get_cpu_usage() const;
   double get_disk_usage() const;
@@ -1121,6 +1126,7 @@ public:
   int calc_resource_weight();
   int calc_resource_weight(
       const LoadFactor& ru_usage, const LoadFactor& ru_capacity, ObResourceWeight& resource_weight);
+  int fill_replica_load();
   int calc_load();
   int fill_partition_groups();  // for ObBalanceReplica
   int fill_tablegroups();       // for ObBalanceReplica
@@ -1160,6 +1166,8 @@ public:
 
   virtual int get_partition_group_data_size(
       const common::ObZone& zone, const int64_t all_tg_idx, const int64_t part_idx, int64_t& data_size) override;
+  virtual int get_partition_group_iops(
+      const common::ObZone& zone, const int64_t all_tg_idx, const int64_t part_idx, double& iops) override;
 
   virtual int get_gts_switch(bool& on) override;
   virtual int get_primary_partition_key(const int64_t all_pg_idx, common::ObPartitionKey& pkey) override;
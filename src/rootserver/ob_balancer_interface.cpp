@@ -198,6 +198,16 @@ int TenantSchemaGetter::get_partition_group_data_size(
   return OB_NOT_IMPLEMENT;
 }
 
+int TenantSchemaGetter::get_partition_group_iops(
+    const common::ObZone& zone, const int64_t all_tg_idx, const int64_t part_idx, double& iops)
+{
+  UNUSED(zone);
+  UNUSED(all_tg_idx);
+  UNUSED(part_idx);
+  UNUSED(iops);
+  return OB_NOT_IMPLEMENT;
+}
+
 int TenantSchemaGetter::get_gts_switch(bool& on)
 {
   UNUSED(on);
@@ -59,6 +59,9 @@ public:
   // Get the sum of data_size of all partitions under pg
   virtual int get_partition_group_data_size(
       const common::ObZone& zone, const int64_t all_tg_idx, const int64_t part_idx, int64_t& data_size) = 0;
+  // Get the sum of reported iops of all partitions under pg
+  virtual int get_partition_group_iops(
+      const common::ObZone& zone, const int64_t all_tg_idx, const int64_t part_idx, double& iops) = 0;
 
   virtual int get_gts_switch(bool& on) = 0;
 
@@ -86,6 +89,8 @@ public:
       const int64_t tablegroup_idx, common::ObIArray<uint64_t>& tids) override;
   virtual int get_partition_group_data_size(
       const common::ObZone& zone, const int64_t all_tg_idx, const int64_t part_idx, int64_t& data_size) override;
+  virtual int get_partition_group_iops(
+      const common::ObZone& zone, const int64_t all_tg_idx, const int64_t part_idx, double& iops) override;
   virtual int get_gts_switch(bool& on) override;
   virtual int get_primary_partition_key(const int64_t all_pg_idx, common::ObPartitionKey& pkey) override;
 
@@ -40,6 +40,18 @@ int RowDiskBalanceStat::get_item_load(int64_t idx, int64_t& load) const
   return ret;
 }
 
+int RowDiskBalanceStat::get_item_iops(int64_t idx, double& iops) const
+{
+  int ret = OB_SUCCESS;
+  if (idx < 0 || idx >= item_disk_info_.count()) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid idx", K(idx), "max", item_disk_info_.count(), K(ret));
+  } else {
+    iops = item_disk_info_.at(idx).iops_;
+  }
+  return ret;
+}
+
 int RowDiskBalanceStat::get_total_load(int64_t& load) const
 {
   load = total_load_.data_size_;
@@ -99,12 +111,15 @@ int RowDiskBalanceStat::init()
         LOG_WARN("NULL unexpected", K(ret));
       } else {
         int64_t data_size = 0;
+        double iops = 0;
         // Sum of partition data_size of multiple tables under tg
         if (OB_FAIL(stat_finder_.get_partition_group_data_size(zone_, item->all_tg_idx_, item->part_idx_, data_size))) {
           LOG_WARN("fail get pg data size", K_(zone), K(ret));
+        } else if (OB_FAIL(stat_finder_.get_partition_group_iops(zone_, item->all_tg_idx_, item->part_idx_, iops))) {
+          LOG_WARN("fail get pg iops", K_(zone), K(ret));
         } else {
           if (OB_SUCC(ret)) {
-            Stat disk(data_size);
+            Stat disk(data_size, iops);
             if (OB_FAIL(item_disk_info_.push_back(disk))) {
               LOG_WARN("fail push back item to item_disk", K(disk));
             } else {
@@ -124,6 +139,7 @@ int RowDiskBalanceStat::init()
               LOG_WARN("NULL unexpected", K(unit_id), K(ret));
             } else {
               unit_disk->v_.data_size_ += data_size;
+              unit_disk->v_.iops_ += iops;
             }
           }
         }
@@ -150,6 +166,7 @@ int UnitDiskBalanceStat::init()
   } else if (OB_FAIL(unit_load_map_.init(unit_stats.count()))) {
     LOG_WARN("fail create map", K(ret));
   } else {
+    int64_t iops_unit_cnt = 0;
     // Build a map index on unit_stats to speed up the search
     ARRAY_FOREACH_X(unit_stats, i, cnt, OB_SUCC(ret))
     {
@@ -165,8 +182,15 @@ int UnitDiskBalanceStat::init()
         LOG_WARN("NULL unexpected", "unit_id", us->get_unit_id(), K(ret));
       } else {
         item->v_.unit_stat_ = us;
+        if (us->capacity_ratio_ > 0) {
+          avg_iops_ += us->get_iops_usage();
+          iops_unit_cnt++;
+        }
       }
     }
+    if (OB_SUCC(ret) && iops_unit_cnt > 0) {
+      avg_iops_ /= static_cast<double>(iops_unit_cnt);
+    }
   }
   if (OB_SUCC(ret)) {
     inited_ = true;
@@ -272,6 +296,69 @@ int UnitDiskBalanceStat::get_max_min_load_unit(UnitStat*& max_u, UnitStat*& min_
   return ret;
 }
 
+int UnitDiskBalanceStat::get_max_min_iops_unit(UnitStat*& max_u, UnitStat*& min_u)
+{
+  int ret = OB_SUCCESS;
+  ObArray<UnitStat*> unit_stats;
+  if (!inited_) {
+    ret = OB_NOT_INIT;
+  } else if (OB_FAIL(unit_provider_.get_units(unit_stats))) {
+    LOG_WARN("fail get units", K(ret));
+  } else {
+    max_u = NULL;
+    min_u = NULL;
+    ARRAY_FOREACH_X(unit_stats, i, cnt, OB_SUCC(ret))
+    {
+      UnitStat* u = unit_stats.at(i);
+      if (NULL == u || NULL == u->server_) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("NULL unexpected", K(i), K(cnt), KP(u), K(ret));
+      } else if (u->capacity_ratio_ <= 0) {
+        // bypass the unit which is excluded by gts
+      } else if (u->server_->can_migrate_out() && u->server_->can_migrate_in()) {
+        if (NULL == max_u || u->get_iops_usage() > max_u->get_iops_usage()) {
+          max_u = u;
+        }
+        if (NULL == min_u || u->get_iops_usage() < min_u->get_iops_usage()) {
+          min_u = u;
+        }
+      }
+    }
+    if (OB_SUCC(ret)) {
+      if (GCONF._balancer_load_tolerance_percentage >= 100) {
+        max_u = min_u = NULL;
+      } else if (NULL == max_u || NULL == min_u || max_u == min_u) {
+        LOG_DEBUG("can not find swapable unit", KP(max_u), KP(min_u));
+        max_u = min_u = NULL;
+      } else {
+        double tolerance = static_cast<double>(GCONF._balancer_load_tolerance_percentage) / 100;
+        if (!need_balance_iops(max_u->get_iops_usage(), avg_iops_, tolerance)) {
+          LOG_DEBUG("read load already balanced or too low", KP(max_u), KP(min_u), K_(avg_iops));
+          max_u = min_u = NULL;
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+// an idle tenant is never balanced by read load, and a unit is balanced only above avg + tolerance
+bool UnitDiskBalanceStat::need_balance_iops(const double max_unit_iops, const double avg_iops, const double tolerance)
+{
+  return avg_iops >= static_cast<double>(MIN_BALANCE_AVG_IOPS) && max_unit_iops >= avg_iops * (1 + tolerance);
+}
+
+int UnitDiskBalanceStat::get_avg_iops(double& avg_iops)
+{
+  int ret = OB_SUCCESS;
+  if (!inited_) {
+    ret = OB_NOT_INIT;
+  } else {
+    avg_iops = avg_iops_;
+  }
+  return ret;
+}
+
 int UnitDiskBalanceStat::get_avg_load(double& avg_load)
 {
   int ret = OB_SUCCESS;
@@ -347,7 +434,7 @@ int DynamicAverageDiskBalancer::balance()
         LOG_WARN("fail get max min load unit", K(ret));
       } else if (NULL != max_u && NULL != min_u) {
         for (int64_t row_idx = 0; OB_SUCC(ret) && row_idx < row_size; ++row_idx) {
-          if (OB_FAIL(one_row_balance(unit_stat_, *max_u, *min_u, row_idx, task_cnt))) {
+          if (OB_FAIL(one_row_balance(unit_stat_, *max_u, *min_u, row_idx, false /*by_iops*/, task_cnt))) {
             LOG_WARN("fail balance one row", K(row_idx), K(map_), K(ret));
           }
         }
@@ -355,11 +442,35 @@ int DynamicAverageDiskBalancer::balance()
     } while (task_cnt > 0);
     // Adjust to the optimal one-time as much as possible to avoid the additional cost of multiple migrations
   }
+
+  // 4. Even out the read load of units by the same exchange on the basis of disk balancing.
+  //    Read load is the 15 minutes moving average reported by observers, and a unit is balanced only when
+  //    its load goes beyond avg + threshold, so a short or small hot spot does not move partitions.
+  //    An exchange must keep the disk usage of both units within the disk threshold,
+  //    otherwise the disk balancing of the next round exchanges them back.
+  if (OB_SUCC(ret) && GCONF._balancer_load_tolerance_percentage < 100) {
+    UnitStat* max_u = NULL;
+    UnitStat* min_u = NULL;
+    int64_t task_cnt = 0;
+    const int64_t row_size = map_.get_row_size();
+    do {
+      task_cnt = 0;
+      if (OB_FAIL(unit_stat_.get_max_min_iops_unit(max_u, min_u))) {
+        LOG_WARN("fail get max min iops unit", K(ret));
+      } else if (NULL != max_u && NULL != min_u) {
+        for (int64_t row_idx = 0; OB_SUCC(ret) && row_idx < row_size; ++row_idx) {
+          if (OB_FAIL(one_row_balance(unit_stat_, *max_u, *min_u, row_idx, true /*by_iops*/, task_cnt))) {
+            LOG_WARN("fail balance one row by iops", K(row_idx), K(map_), K(ret));
+          }
+        }
+      }
+    } while (OB_SUCC(ret) && task_cnt > 0);
+  }
   return ret;
 }
 
-int DynamicAverageDiskBalancer::one_row_balance(
-    UnitDiskBalanceStat& unit_stat, UnitStat& max_u, UnitStat& min_u, int64_t row_idx, int64_t& task_cnt)
+int DynamicAverageDiskBalancer::one_row_balance(UnitDiskBalanceStat& unit_stat, UnitStat& max_u, UnitStat& min_u,
+    int64_t row_idx, const bool by_iops, int64_t& task_cnt)
 {
   int ret = OB_SUCCESS;
   int64_t col_size = map_.get_col_size();
@@ -393,9 +504,16 @@ int DynamicAverageDiskBalancer::one_row_balance(
                    item->get_memstore_percent() == replace->get_memstore_percent() &&
                    REPLICA_TYPE_LOGONLY != replace->get_replica_type()) {
           bool exchangable = false;
-          if (OB_FAIL(test_and_exchange(unit_stat, max_u, min_u, row_stat, col_idx, *item, i, *replace, exchangable))) {
+          if (by_iops) {
+            if (OB_FAIL(test_and_exchange_iops(
+                    unit_stat, max_u, min_u, row_stat, col_idx, *item, i, *replace, exchangable))) {
+              LOG_WARN("fail test_exchangable by iops", K(ret));
+            }
+          } else if (OB_FAIL(test_and_exchange(
+                         unit_stat, max_u, min_u, row_stat, col_idx, *item, i, *replace, exchangable))) {
             LOG_WARN("fail test_exchangable", K(ret));
-          } else if (exchangable) {
+          }
+          if (OB_SUCC(ret) && exchangable) {
             task_cnt++;
           }
         }
@@ -491,6 +609,89 @@ int DynamicAverageDiskBalancer::test_and_exchange(UnitDiskBalanceStat& unit_stat
   return ret;
 }
 
+int DynamicAverageDiskBalancer::test_and_exchange_iops(UnitDiskBalanceStat& unit_stat, UnitStat& max_u,
+    UnitStat& min_u, RowDiskBalanceStat& row_stat, int64_t idx_a, SquareIdMap::Item& a, int64_t idx_b,
+    SquareIdMap::Item& b, bool& exchangable)
+{
+  int ret = OB_SUCCESS;
+  exchangable = false;
+  if (a.dest_unit_id_ != b.dest_unit_id_ && GCONF._balancer_load_tolerance_percentage < 100) {
+    double avg_iops = 0;
+    double avg_load = 0;
+    double item_iops_max = 0;
+    double item_iops_min = 0;
+    int64_t item_load_max = 0;
+    int64_t item_load_min = 0;
+    double tolerance = static_cast<double>(GCONF._balancer_load_tolerance_percentage) / 100;
+    if (OB_FAIL(unit_stat.get_avg_iops(avg_iops))) {
+      LOG_WARN("fail get avg iops", K(ret));
+    } else if (OB_FAIL(unit_stat.get_avg_load(avg_load))) {
+      LOG_WARN("fail get avg load", K(ret));
+    } else if (OB_FAIL(row_stat.get_item_iops(idx_a, item_iops_max))) {
+      LOG_WARN("fail get item iops", K(idx_a), K(a), K(ret));
+    } else if (OB_FAIL(row_stat.get_item_iops(idx_b, item_iops_min))) {
+      LOG_WARN("fail get item iops", K(idx_b), K(b), K(ret));
+    } else if (OB_FAIL(row_stat.get_item_load(idx_a, item_load_max))) {
+      LOG_WARN("fail get item load", K(idx_a), K(a), K(ret));
+    } else if (OB_FAIL(row_stat.get_item_load(idx_b, item_load_min))) {
+      LOG_WARN("fail get item load", K(idx_b), K(b), K(ret));
+    } else {
+      double unit_iops_max = max_u.get_iops_usage();
+      double unit_iops_min = min_u.get_iops_usage();
+      double new_unit_iops_max = unit_iops_max - item_iops_max + item_iops_min;
+      double new_unit_iops_min = unit_iops_min - item_iops_min + item_iops_max;
+      double upper_iops = avg_iops * (1 + tolerance);
+
+      int64_t unit_load_max = static_cast<int64_t>(max_u.get_disk_usage());
+      int64_t unit_load_min = static_cast<int64_t>(min_u.get_disk_usage());
+      int64_t new_unit_load_max = unit_load_max - item_load_max + item_load_min;
+      int64_t new_unit_load_min = unit_load_min - item_load_min + item_load_max;
+      double disk_tolerance = static_cast<double>(GCONF.balancer_tolerance_percentage) / 100;
+      int64_t upper_load_max = static_cast<int64_t>((avg_load + disk_tolerance) * max_u.get_disk_limit());
+      int64_t upper_load_min = static_cast<int64_t>((avg_load + disk_tolerance) * min_u.get_disk_limit());
+
+      if (can_exchange_iops(item_iops_max, item_iops_min, unit_iops_max, unit_iops_min, avg_iops, tolerance) &&
+          new_unit_load_max <= std::max(unit_load_max, upper_load_max) &&
+          new_unit_load_min <= std::max(unit_load_min, upper_load_min)) {
+        LOG_INFO("SWAP ITEM TO LOWER a READ LOAD",
+            "unit_max",
+            a.dest_unit_id_,
+            "unit_min",
+            b.dest_unit_id_,
+            K(unit_iops_max),
+            K(unit_iops_min),
+            K(new_unit_iops_max),
+            K(new_unit_iops_min),
+            K(avg_iops),
+            K(upper_iops),
+            K(new_unit_load_max),
+            K(new_unit_load_min),
+            K(upper_load_max),
+            K(upper_load_min));
+        exchangable = true;
+        max_u.load_factor_.add_iops_usage(item_iops_min - item_iops_max);
+        min_u.load_factor_.add_iops_usage(item_iops_max - item_iops_min);
+        max_u.load_factor_.set_disk_used(new_unit_load_max);
+        min_u.load_factor_.set_disk_used(new_unit_load_min);
+        exchange(a, b);
+      }
+    }
+  }
+  return ret;
+}
+
+// An exchange must move enough read load to pay for the migration, and it must bring the hot unit down
+// without pushing either unit to the other side of the band, otherwise the next round swaps them back.
+bool DynamicAverageDiskBalancer::can_exchange_iops(const double item_iops_max, const double item_iops_min,
+    const double unit_iops_max, const double unit_iops_min, const double avg_iops, const double tolerance)
+{
+  const double moved_iops = item_iops_max - item_iops_min;
+  const double upper_iops = avg_iops * (1 + tolerance);
+  return moved_iops >= static_cast<double>(MIN_EXCHANGE_IOPS) && moved_iops >= item_iops_max * tolerance &&
+         unit_iops_max > upper_iops && unit_iops_min < avg_iops && unit_iops_max - moved_iops > avg_iops &&
+         unit_iops_min + moved_iops < upper_iops;
+}
+
 void DynamicAverageDiskBalancer::exchange(SquareIdMap::Item& a, SquareIdMap::Item& b)
 {
   uint64_t tmp = a.dest_unit_id_;
@@ -532,6 +733,7 @@ int DynamicAverageDiskBalancer::update_unit_stat(UnitDiskBalanceStat& unit_stat)
         for (int64_t col_idx = 0; OB_SUCC(ret) && col_idx < col_size; ++col_idx) {
           SquareIdMap::Item* item = NULL;
           int64_t item_data_size = 0;
+          double item_iops = 0;
           UnitStat* from_unit = NULL;
           UnitStat* to_unit = NULL;
           if (OB_FAIL(map_.get(row_idx, col_idx, item))) {
@@ -542,6 +744,8 @@ int DynamicAverageDiskBalancer::update_unit_stat(UnitDiskBalanceStat& unit_stat)
           } else if (item->unit_id_ != item->dest_unit_id_) {
             if (OB_FAIL(row_stat.get_item_load(col_idx, item_data_size))) {
               LOG_WARN("fail get item load", K(col_idx), K(ret));
+            } else if (OB_FAIL(row_stat.get_item_iops(col_idx, item_iops))) {
+              LOG_WARN("fail get item iops", K(col_idx), K(ret));
             } else if (OB_FAIL(unit_stat.get_unit_load(item->unit_id_, from_unit))) {
               LOG_WARN("fail get unit load", "from", item->unit_id_, K(ret));
             } else if (OB_FAIL(unit_stat.get_unit_load(item->dest_unit_id_, to_unit))) {
@@ -551,6 +755,8 @@ int DynamicAverageDiskBalancer::update_unit_stat(UnitDiskBalanceStat& unit_stat)
               int64_t new_unit_load_to = static_cast<int64_t>(to_unit->get_disk_usage()) + item_data_size;
               from_unit->load_factor_.set_disk_used(new_unit_load_from);
               to_unit->load_factor_.set_disk_used(new_unit_load_to);
+              from_unit->load_factor_.add_iops_usage(-item_iops);
+              to_unit->load_factor_.add_iops_usage(item_iops);
             }
           }
         }
@@ -37,12 +37,13 @@ namespace balancer {
 class RowDiskBalanceStat {
 public:
   struct RowItemDiskStat {
-    RowItemDiskStat(int64_t data_size) : key_(0), data_size_(data_size)
+    RowItemDiskStat(int64_t data_size, double iops) : key_(0), data_size_(data_size), iops_(iops)
     {}
-    RowItemDiskStat() : key_(0), data_size_(0)
+    RowItemDiskStat() : key_(0), data_size_(0), iops_(0)
     {}
     int64_t key_;  // for ObReferedMap
     int64_t data_size_;
+    double iops_;
     const int64_t& get_key() const
     {
       return key_;
@@ -51,7 +52,7 @@ public:
     {
       key_ = key;
     }
-    TO_STRING_KV(K_(key), K_(data_size));
+    TO_STRING_KV(K_(key), K_(data_size), K_(iops));
   };
   typedef RowItemDiskStat Stat;
   typedef common::hash::ObReferedMap<int64_t, Stat> UnitLoadMap;
@@ -59,7 +60,7 @@ public:
 public:
   RowDiskBalanceStat(ITenantStatFinder& stat_finder, common::ObZone& zone, SquareIdMap& map, int64_t row_idx)
       : item_disk_info_(),
-        total_load_(0),
+        total_load_(),
         unit_load_map_(),
         stat_finder_(stat_finder),
         zone_(zone),
@@ -74,6 +75,7 @@ public:
     return item_disk_info_.count();
   }
   int get_item_load(int64_t idx, int64_t& load) const;
+  int get_item_iops(int64_t idx, double& iops) const;
   int get_unit_load(int64_t unit_id, int64_t& load) const;
   int get_unit_load(int64_t unit_id, Stat*& unit_load);
   int get_total_load(int64_t& load) const;
@@ -113,7 +115,7 @@ public:
 
 public:
   UnitDiskBalanceStat(IUnitProvider& unit_provider)
-      : inited_(false), unit_provider_(unit_provider), unit_load_map_(), avg_load_(0)
+      : inited_(false), unit_provider_(unit_provider), unit_load_map_(), avg_load_(0), avg_iops_(0)
   {}
   ~UnitDiskBalanceStat()
   {}
@@ -121,13 +123,21 @@ public:
   int get_unit_load(uint64_t unit_id, UnitStat*& unit_stat);
   int get_avg_load(double& avg);
   int get_max_min_load_unit(UnitStat*& max_u, UnitStat*& min_u);
+  // units of a zone share one unit config, read load is compared in absolute iops
+  int get_avg_iops(double& avg);
+  int get_max_min_iops_unit(UnitStat*& max_u, UnitStat*& min_u);
+  static bool need_balance_iops(const double max_unit_iops, const double avg_iops, const double tolerance);
   void debug_dump();
 
+public:
+  static const int64_t MIN_BALANCE_AVG_IOPS = 100;
+
 private:
   bool inited_;
   IUnitProvider& unit_provider_;
   UnitLoadMap unit_load_map_;
   double avg_load_;
+  double avg_iops_;
 };
 
 // Dynamically adjust disk balance
@@ -146,12 +156,21 @@ public:
   {}
 
   virtual int balance() override;
+  // whether swapping an item of the max unit with an item of the min unit evens out the read load
+  static bool can_exchange_iops(const double item_iops_max, const double item_iops_min, const double unit_iops_max,
+      const double unit_iops_min, const double avg_iops, const double tolerance);
+
+public:
+  static const int64_t MIN_EXCHANGE_IOPS = 50;
 
 private:
-  int one_row_balance(
-      UnitDiskBalanceStat& unit_stat, UnitStat& max_u, UnitStat& min_u, int64_t row_idx, int64_t& task_cnt);
+  int one_row_balance(UnitDiskBalanceStat& unit_stat, UnitStat& max_u, UnitStat& min_u, int64_t row_idx,
+      const bool by_iops, int64_t& task_cnt);
   int test_and_exchange(UnitDiskBalanceStat& unit_stat, UnitStat& max_u, UnitStat& min_u, RowDiskBalanceStat& row_stat,
       int64_t idx_a, SquareIdMap::Item& a, int64_t idx_b, SquareIdMap::Item& b, bool& exchangable);
+  int test_and_exchange_iops(UnitDiskBalanceStat& unit_stat, UnitStat& max_u, UnitStat& min_u,
+      RowDiskBalanceStat& row_stat, int64_t idx_a, SquareIdMap::Item& a, int64_t idx_b, SquareIdMap::Item& b,
+      bool& exchangable);
   void exchange(SquareIdMap::Item& a, SquareIdMap::Item& b);
   int update_unit_stat(UnitDiskBalanceStat& unit_stat);
 
@@ -134,6 +134,10 @@ DEF_BOOL(enable_sql_audit, OB_CLUSTER_PARAMETER, "true",
     "specifies whether SQL audit is turned on. "
     "The default value is TRUE. Value: TRUE: turned on FALSE: turned off",
     ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_sql_audit_sample_ratio, OB_CLUSTER_PARAMETER, "100", "[1,100]",
+    "the percentage of successful and fast requests recorded in SQL audit, failed requests and "
+    "requests slower than trace_log_slow_query_watermark are always recorded. Range: [1,100]",
+    ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_BOOL(enable_record_trace_id, OB_CLUSTER_PARAMETER, "true", "specifies whether record app trace id is turned on.",
     ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_BOOL(enable_rich_error_msg, OB_CLUSTER_PARAMETER, "false",
@@ -590,6 +594,12 @@ DEF_INT(balancer_emergency_percentage, OB_CLUSTER_PARAMETER, "80", "[1, 100]",
     "will always try migrate out partitions."
     "Range: [1, 100] in percentage",
     ObParameterAttr(Section::LOAD_BALANCE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_balancer_load_tolerance_percentage, OB_CLUSTER_PARAMETER, "100", "[1, 100]",
+    "specifies the tolerance (in percentage) of the unbalance of the read load among units of a zone. "
+    "Partitions are swapped between units when the read load of a unit goes beyond the average by "
+    "more than this percentage, 100 means read load is not balanced. "
+    "Range: [1, 100] in percentage",
+    ObParameterAttr(Section::LOAD_BALANCE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT(server_data_copy_in_concurrency, OB_CLUSTER_PARAMETER, "2", "[1,1000]",
     "the maximum number of partitions allowed to migrate to the server. "
     "Range: [1, 1000], integer",
@@ -925,6 +935,10 @@ DEF_INT(_large_query_io_percentage, OB_CLUSTER_PARAMETER, "0", "[0,100]",
     "the max percentage of io resource for big queries. Range: [0,100] in integer. Especially, 0 means unlimited. The "
     "default value is 0.",
     ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_temporary_file_io_percentage, OB_CLUSTER_PARAMETER, "0", "[0,100]",
+    "the max percentage of io resource for temporary files of sql spilling, which get a dedicated io channel. "
+    "Range: [0,100] in integer. Especially, 0 means temporary files share the user io. The default value is 0.",
+    ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 DEF_BOOL(_enable_parallel_minor_merge, OB_TENANT_PARAMETER, "False",
     "specifies whether to enable parallel minor merge. "
@@ -945,6 +959,10 @@ DEF_INT(restore_concurrency, OB_CLUSTER_PARAMETER, "0", "[0,512]",
 DEF_INT(merge_stat_sampling_ratio, OB_CLUSTER_PARAMETER, "100", "[0,100]",
     "column stats sampling ratio daily merge. Range: [0,100] in integer",
     ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_merge_histogram_bucket_count, OB_CLUSTER_PARAMETER, "254", "[0,1024]",
+    "the max bucket count of column histograms built from the sampled rows of full major merge, "
+    "0 means histograms are not built. Range: [0,1024] in integer",
+    ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT(minor_freeze_times, OB_CLUSTER_PARAMETER, "100", "[0, 65535]",
     "specifies how many minor freezes should be triggered between two major freezes. Range: [0, 65535]",
     ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -990,6 +1008,10 @@ DEF_TIME(_ob_minor_merge_schedule_interval, OB_CLUSTER_PARAMETER, "20s", "[3s,3m
     "the time interval to schedule minor mrerge, Range: [3s,3m]"
     "Range: [3s, 3m]",
     ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_minor_merge_read_amplification_priority, OB_CLUSTER_PARAMETER, "True",
+    "specifies whether minor merges are scheduled first for partitions whose reads probe the most minor sstables"
+    "Value: True:turned on;  False: turned off",
+    ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 DEF_INT(sys_bkgd_migration_retry_num, OB_CLUSTER_PARAMETER, "3", "[3,100]",
     "retry num limit during migration. Range: [3, 100] in integer",
@@ -1040,6 +1062,10 @@ DEF_INT(_migrate_block_verify_level, OB_CLUSTER_PARAMETER, "1", "[0,2]",
     "1 : physical verification"
     "2 : logical verification",
     ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_migrate_block_fetch_stream_count, OB_CLUSTER_PARAMETER, "4", "[1,64]",
+    "the number of streams the macro blocks of one sstable are split into and fetched in parallel "
+    "during migration and rebuild. Range: [1, 64] in integer",
+    ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 DEF_TIME(_cache_wash_interval, OB_CLUSTER_PARAMETER, "200ms", "[1ms, 1m]", "specify interval of cache background wash",
     ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -1483,6 +1509,10 @@ DEF_INT(_max_schema_slot_num, OB_CLUSTER_PARAMETER, "128", "[2,8192]",
     "the max schema slot number for each tenant, "
     "Range: [2, 8192] in integer",
     ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_schema_refresh_thread_count, OB_CLUSTER_PARAMETER, "8", "[1,64]",
+    "the max number of threads to refresh full schemas of tenants in parallel, 1 means one by one. "
+    "Range: [1, 64] in integer",
+    ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_BOOL(_enable_fulltext_index, OB_CLUSTER_PARAMETER, "False", "enable full text index",
     ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT_WITH_CHECKER(_ob_query_rate_limit, OB_TENANT_PARAMETER, "-1", common::ObConfigQueryRateLimitChecker,
@@ -1526,6 +1556,19 @@ DEF_TIME(ilog_index_expire_time, OB_CLUSTER_PARAMETER, "7d", "[0s, 60d]",
     "specifies the expire time of ilog_index, can use this parameter to limit the"
     "memory usage of file_id_cache",
     ObParameterAttr(Section::CLOG, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_ilog_mmap_index, OB_CLUSTER_PARAMETER, "True",
+    "specifies whether to persist the sorted cursors of old version ilog files as mmap index, "
+    "so that cursor queries on these files are served by page cache instead of ilog cache. "
+    "Value: True: turned on False: turned off",
+    ObParameterAttr(Section::CLOG, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_CAP(_extlog_read_ahead_window_size, OB_CLUSTER_PARAMETER, "8M", "[0M, 64M]",
+    "the max size of clog data being read ahead into line cache for one lagging liboblog stream, "
+    "0 means read-ahead is turned off. Range: [0M, 64M]",
+    ObParameterAttr(Section::CLOG, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_CAP(_extlog_read_ahead_io_budget, OB_CLUSTER_PARAMETER, "256M", "[0M, 2G]",
+    "the max size of clog data being read ahead into line cache for all liboblog streams, "
+    "0 means read-ahead is turned off. Range: [0M, 2G]",
+    ObParameterAttr(Section::CLOG, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 // auto drop restoring tenant if physical restore fails
 DEF_BOOL(_auto_drop_tenant_if_restore_failed, OB_CLUSTER_PARAMETER, "True",
     "auto drop restoring tenant if physical restore fails",
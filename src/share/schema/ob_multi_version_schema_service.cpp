@@ -2900,37 +2900,22 @@ int ObMultiVersionSchemaService::refresh_and_add_schema(
         } else if (OB_FAIL(schema_mgr->get_tenant_ids(all_tenant_ids))) {
           LOG_WARN("fail to get all tenant_ids", K(ret));
         } else {
-          // Ignore that some tenants fail to refresh the schema,
-          // and need to report an error to the upper layer to avoid pushing up last_refresh_schema_info
-          int tmp_ret = OB_SUCCESS;
-          for (int64_t i = 0; i < all_tenant_ids.count(); i++) {
+          ObArray<uint64_t> normal_tenant_ids;
+          for (int64_t i = 0; OB_SUCC(ret) && i < all_tenant_ids.count(); i++) {
             const uint64_t tenant_id = all_tenant_ids.at(i);
             if (OB_SYS_TENANT_ID == tenant_id) {
               // skip
-            } else if (OB_SUCCESS != (tmp_ret = refresh_tenant_schema(tenant_id))) {
-              LOG_WARN("fail to refresh tenant schema", K(tmp_ret), K(tenant_id));
+            } else if (OB_FAIL(normal_tenant_ids.push_back(tenant_id))) {
+              LOG_WARN("fail to push back tenant_id", K(ret), K(tenant_id));
             }
-            if (OB_SUCCESS != tmp_ret && OB_SUCCESS == ret) {
-              ret = tmp_ret;
-            }
-          }
-        }
-      } else {
-        // Ignore that some tenants fail to refresh the schema,
-        // and need to report an error to the upper layer to avoid pushing up last_refresh_schema_info
-        int tmp_ret = OB_SUCCESS;
-        for (int64_t i = 0; i < tenant_ids.count(); i++) {
-          const uint64_t tenant_id = tenant_ids.at(i);
-          if (OB_INVALID_TENANT_ID == tenant_id) {
-            tmp_ret = OB_INVALID_ARGUMENT;
-            LOG_WARN("invalid tenant_id", K(tmp_ret), K(tenant_id));
-          } else if (OB_SUCCESS != (tmp_ret = refresh_tenant_schema(tenant_id))) {
-            LOG_WARN("fail to refresh tenant schema", K(tmp_ret), K(tenant_id));
           }
-          if (OB_SUCCESS != tmp_ret && OB_SUCCESS == ret) {
-            ret = tmp_ret;
+          if (OB_FAIL(ret)) {
+          } else if (OB_FAIL(refresh_tenant_schemas(normal_tenant_ids))) {
+            LOG_WARN("fail to refresh tenant schemas", K(ret), K(normal_tenant_ids));
           }
         }
+      } else if (OB_FAIL(refresh_tenant_schemas(tenant_ids))) {
+        LOG_WARN("fail to refresh tenant schemas", K(ret), K(tenant_ids));
       }
       schema_stack_allocator() = nullptr;
     };
@@ -2949,6 +2934,110 @@ int ObMultiVersionSchemaService::refresh_and_add_schema(
   return ret;
 }
 
+// Full refreshes of different tenants only touch their own schema structures (the mock schema infos shared
+// by all tenants in standby cluster are updated under mock_schema_info_lock_), so tenants which have not
+// been refreshed yet (e.g. on observer start) are refreshed by several threads. The others are refreshed
+// one by one in the current thread, and sys tenant is always refreshed before the parallel ones since it
+// initializes the structures of the other tenants.
+// Ignore that some tenants fail to refresh the schema,
+// and need to report an error to the upper layer to avoid pushing up last_refresh_schema_info
+int ObMultiVersionSchemaService::refresh_tenant_schemas(const ObIArray<uint64_t>& tenant_ids)
+{
+  int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
+  const int64_t thread_cnt = ObSchemaService::g_liboblog_mode_ ? 1 : GCONF._schema_refresh_thread_count;
+  ObArray<uint64_t> full_tenant_ids;
+  for (int64_t i = 0; i < tenant_ids.count(); i++) {
+    const uint64_t tenant_id = tenant_ids.at(i);
+    bool refresh_full_schema = false;
+    tmp_ret = OB_SUCCESS;
+    if (OB_INVALID_TENANT_ID == tenant_id) {
+      tmp_ret = OB_INVALID_ARGUMENT;
+      LOG_WARN("invalid tenant_id", K(tmp_ret), K(tenant_id));
+    } else if (thread_cnt > 1 && OB_SYS_TENANT_ID != tenant_id &&
+               OB_SUCCESS == refresh_full_schema_map_.get_refactored(tenant_id, refresh_full_schema) &&
+               refresh_full_schema) {
+      if (OB_SUCCESS != (tmp_ret = full_tenant_ids.push_back(tenant_id))) {
+        LOG_WARN("fail to push back tenant_id", K(tmp_ret), K(tenant_id));
+      }
+    } else if (OB_SUCCESS != (tmp_ret = refresh_tenant_schema(tenant_id))) {
+      LOG_WARN("fail to refresh tenant schema", K(tmp_ret), K(tenant_id));
+    }
+    if (OB_SUCCESS != tmp_ret && OB_SUCCESS == ret) {
+      ret = tmp_ret;
+    }
+  }
+
+  if (full_tenant_ids.count() > 0) {
+    const int64_t start = ObTimeUtility::current_time();
+    bool refreshed = false;
+    tmp_ret = OB_SUCCESS;
+    if (full_tenant_ids.count() > 1) {
+      TenantSchemaRefresher refresher(*this, full_tenant_ids);
+      if (OB_SUCCESS != (tmp_ret = refresher.set_thread_count(std::min(thread_cnt, full_tenant_ids.count())))) {
+        LOG_WARN("fail to set refresher thread count", K(tmp_ret), K(thread_cnt));
+      } else if (OB_SUCCESS != (tmp_ret = refresher.start())) {
+        LOG_WARN("fail to start refresher, refresh tenants one by one", K(tmp_ret), K(thread_cnt));
+      } else {
+        refresher.wait();
+        tmp_ret = refresher.get_ret();
+        refreshed = true;
+      }
+      refresher.destroy();
+    }
+    if (!refreshed) {
+      tmp_ret = OB_SUCCESS;
+      for (int64_t i = 0; i < full_tenant_ids.count(); i++) {
+        int refresh_ret = OB_SUCCESS;
+        if (OB_SUCCESS != (refresh_ret = refresh_tenant_schema(full_tenant_ids.at(i)))) {
+          LOG_WARN("fail to refresh tenant schema", K(refresh_ret), "tenant_id", full_tenant_ids.at(i));
+          tmp_ret = (OB_SUCCESS == tmp_ret ? refresh_ret : tmp_ret);
+        }
+      }
+    }
+    if (OB_SUCCESS != tmp_ret && OB_SUCCESS == ret) {
+      ret = tmp_ret;
+    }
+    LOG_INFO("[REFRESH_SCHEMA] refresh full schema of tenants",
+        K(tmp_ret),
+        "tenant_cnt",
+        full_tenant_ids.count(),
+        K(thread_cnt),
+        "cost",
+        ObTimeUtility::current_time() - start);
+  }
+  return ret;
+}
+
+void ObMultiVersionSchemaService::TenantSchemaRefresher::run1()
+{
+  int ret = OB_SUCCESS;
+  lib::set_thread_name("SchemaRefresh");
+  auto func = [&]() {
+    // the same as the refreshing thread, memory on the stack is charged to 500 tenant
+    ObArenaAllocator allocator(ObModIds::OB_MODULE_PAGE_ALLOCATOR, OB_MALLOC_BIG_BLOCK_SIZE, OB_SERVER_TENANT_ID);
+    schema_stack_allocator() = &allocator;
+    int64_t idx = 0;
+    while ((idx = ATOMIC_FAA(&next_idx_, 1)) < tenant_ids_.count()) {
+      const uint64_t tenant_id = tenant_ids_.at(idx);
+      int tmp_ret = OB_SUCCESS;
+      if (OB_SUCCESS != (tmp_ret = schema_service_.refresh_tenant_schema(tenant_id))) {
+        LOG_WARN("fail to refresh tenant schema", K(tmp_ret), K(tenant_id));
+        (void)ATOMIC_BCAS(&ret_, OB_SUCCESS, tmp_ret);
+      }
+    }
+    schema_stack_allocator() = nullptr;
+  };
+  CREATE_WITH_TEMP_ENTITY(RESOURCE_OWNER, common::OB_SERVER_TENANT_ID)
+  {
+    func();
+  }
+  else
+  {
+    func();
+  }
+}
+
 // It is used to determine the initial Partition set when liboblog starts, and obtain the maximum schema_version
 // that meets the requirements of <=timestamp. The schema_version should be as large as possible;
 // it is also used for schema history recycle
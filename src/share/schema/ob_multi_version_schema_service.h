@@ -18,6 +18,7 @@
 #include "lib/string/ob_string.h"
 #include "lib/container/ob_array.h"
 #include "share/ob_errno.h"
+#include "share/ob_thread_pool.h"
 #include "share/schema/ob_server_schema_service.h"
 #include "share/schema/ob_schema_cache.h"
 #include "share/schema/ob_schema_store.h"
@@ -255,6 +256,7 @@ private:
   virtual int get_inner_schema_guard(ObSchemaGetterGuard& guard, int64_t schema_version = common::OB_INVALID_VERSION,
       const RefreshSchemaMode refresh_schema_mode = RefreshSchemaMode::NORMAL);
   int refresh_tenant_schema(const uint64_t tenant_id);
+  int refresh_tenant_schemas(const common::ObIArray<uint64_t>& tenant_ids);
   virtual int add_schema_mgr_info(ObSchemaGetterGuard& schema_guard, ObSchemaStore* schema_store,
       const ObRefreshSchemaStatus& schema_status, const uint64_t tenant_id, const int64_t snapshot_version,
       const int64_t latest_local_version, const RefreshSchemaMode refresh_schema_mode = RefreshSchemaMode::NORMAL);
@@ -275,6 +277,31 @@ private:
   int get_schema_status(const common::ObArray<ObRefreshSchemaStatus>& schema_status_array, const uint64_t tenant_id,
       ObRefreshSchemaStatus& schema_status);
 
+private:
+  // refreshes full schemas of tenants taken one by one from tenant_ids, the first error is kept
+  class TenantSchemaRefresher : public share::ObThreadPool {
+  public:
+    TenantSchemaRefresher(ObMultiVersionSchemaService& schema_service, const common::ObIArray<uint64_t>& tenant_ids)
+        : schema_service_(schema_service), tenant_ids_(tenant_ids), next_idx_(0), ret_(common::OB_SUCCESS)
+    {}
+    virtual ~TenantSchemaRefresher()
+    {}
+    virtual void run1() override;
+    int get_ret() const
+    {
+      return ATOMIC_LOAD(&ret_);
+    }
+
+  private:
+    ObMultiVersionSchemaService& schema_service_;
+    const common::ObIArray<uint64_t>& tenant_ids_;
+    int64_t next_idx_;
+    int ret_;
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(TenantSchemaRefresher);
+  };
+
 private:
   static const int64_t MAX_VERSION_COUNT = 64;
   static const int64_t MAX_VERSION_COUNT_FOR_LIBOBLOG = 6;
@@ -18,6 +18,7 @@
 #include "lib/container/ob_vector.h"
 #include "lib/allocator/page_arena.h"
 #include "lib/hash/ob_pointer_hashmap.h"
+#include "lib/hash/ob_cow_pointer_hashmap.h"
 #include "share/schema/ob_schema_struct.h"
 #include "share/schema/ob_table_schema.h"
 #include "share/schema/ob_priv_mgr.h"
@@ -685,10 +686,13 @@ class ObSchemaMgr {
   typedef DropTenantInfos::const_iterator ConstDropTenantInfoIterator;
   typedef common::hash::ObPointerHashMap<ObDatabaseSchemaHashWrapper, ObSimpleDatabaseSchema*, GetTableKeyV2>
       DatabaseNameMap;
-  typedef common::hash::ObPointerHashMap<uint64_t, ObSimpleTableSchemaV2*, GetTableKeyV2> TableIdMap;
+  // table maps grow with the table count, they share unchanged shards with the schema mgr they are assigned from
+  typedef common::hash::ObCowPointerHashMap<uint64_t, ObSimpleTableSchemaV2*, GetTableKeyV2> TableIdMap;
   typedef common::hash::ObPointerHashMap<uint64_t, ObSimpleDatabaseSchema*, GetTableKeyV2> DatabaseIdMap;
-  typedef common::hash::ObPointerHashMap<ObTableSchemaHashWrapper, ObSimpleTableSchemaV2*, GetTableKeyV2> TableNameMap;
-  typedef common::hash::ObPointerHashMap<ObIndexSchemaHashWrapper, ObSimpleTableSchemaV2*, GetTableKeyV2> IndexNameMap;
+  typedef common::hash::ObCowPointerHashMap<ObTableSchemaHashWrapper, ObSimpleTableSchemaV2*, GetTableKeyV2>
+      TableNameMap;
+  typedef common::hash::ObCowPointerHashMap<ObIndexSchemaHashWrapper, ObSimpleTableSchemaV2*, GetTableKeyV2>
+      IndexNameMap;
   typedef common::hash::ObPointerHashMap<ObForeignKeyInfoHashWrapper, ObSimpleForeignKeyInfo*, GetTableKeyV2>
       ForeignKeyNameMap;
   typedef common::hash::ObPointerHashMap<ObConstraintInfoHashWrapper, ObSimpleConstraintInfo*, GetTableKeyV2>
@@ -5565,7 +5565,8 @@ int ObServerSchemaService::get_increment_schema_operations(const ObRefreshSchema
   return ret;
 }
 
-// Use mock_schema_info_map_ read-write lock, no need to lock here
+// Use mock_schema_info_map_ read-write lock, no need to lock here.
+// Writers are serialized by mock_schema_info_lock_ in reload_mock_schema_info().
 int ObServerSchemaService::get_mock_schema_info(
     const uint64_t schema_id, const ObSchemaType schema_type, ObMockSchemaInfo& mock_schema_info)
 {
@@ -5629,6 +5630,7 @@ int ObServerSchemaService::reload_mock_schema_info(const ObSchemaMgr& schema_mgr
     } else if (OB_FAIL(schema_service_->get_mock_schema_infos(*sql_proxy_, tenant_ids, new_mock_schema_infos))) {
       LOG_WARN("fail to load mock schema infos from inner_table", K(ret));
     } else {
+      lib::ObMutexGuard guard(mock_schema_info_lock_);
       // get remove mock_schema_infos
       ObMockSchemaInfo mock_schema_info;
       FOREACH_X(it, mock_schema_info_map_, OB_SUCC(ret))
@@ -763,6 +763,8 @@ protected:
   common::hash::ObHashMap<uint64_t, ObSchemaMemMgr*, common::hash::ReadWriteDefendMode> mem_mgr_map_;
   common::hash::ObHashMap<uint64_t, ObSchemaMemMgr*, common::hash::ReadWriteDefendMode> mem_mgr_for_liboblog_map_;
   common::hash::ObHashMap<uint64_t, ObMockSchemaInfo, common::hash::ReadWriteDefendMode> mock_schema_info_map_;
+  // tenants may refresh schema concurrently, serializes the iterate-and-update in reload_mock_schema_info
+  lib::ObMutex mock_schema_info_lock_;
   common::hash::ObHashMap<uint64_t, int64_t, common::hash::ReadWriteDefendMode> schema_split_version_v2_map_;
 };
 
@@ -0,0 +1,364 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX COMMON
+#include "share/stat/ob_histogram_builder.h"
+#include <algorithm>
+#include "lib/container/ob_array_iterator.h"
+
+namespace oceanbase {
+namespace common {
+
+namespace {
+// replaced samples are reclaimed once the arena grows beyond this
+const int64_t COMPACT_MIN_SIZE = 1L << 20;
+
+struct SampleCompare {
+  bool operator()(const ObObj& left, const ObObj& right) const
+  {
+    return left.compare(right) < 0;
+  }
+};
+}  // namespace
+
+ObHistogramBuilder::ObHistogramBuilder()
+    : allocator_("HistSample"),
+      compact_allocator_("HistSample"),
+      cur_allocator_(&allocator_),
+      next_allocator_(&compact_allocator_),
+      samples_(),
+      seen_count_(0),
+      live_size_(0),
+      random_()
+{}
+
+ObHistogramBuilder::~ObHistogramBuilder()
+{
+  reset();
+}
+
+void ObHistogramBuilder::reset()
+{
+  samples_.reset();
+  allocator_.reset();
+  compact_allocator_.reset();
+  cur_allocator_ = &allocator_;
+  next_allocator_ = &compact_allocator_;
+  seen_count_ = 0;
+  live_size_ = 0;
+}
+
+int ObHistogramBuilder::add_value(const ObObj& value)
+{
+  int ret = OB_SUCCESS;
+  if (value.is_null()) {
+    // nulls are counted by column stat
+  } else {
+    ++seen_count_;
+    if (value.get_deep_copy_size() > MAX_SAMPLE_VALUE_SIZE) {
+      // too large to be an endpoint
+    } else if (samples_.count() < MAX_SAMPLE_COUNT) {
+      if (OB_FAIL(store_sample_(samples_.count(), value))) {
+        LOG_WARN("failed to store sample", K(ret), K(value));
+      }
+    } else {
+      const int64_t idx = random_.get(0, seen_count_ - 1);
+      if (idx < MAX_SAMPLE_COUNT && OB_FAIL(store_sample_(idx, value))) {
+        LOG_WARN("failed to store sample", K(ret), K(idx), K(value));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObHistogramBuilder::merge(const ObHistogramBuilder& other)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(this == &other)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("can not merge builder with itself", K(ret));
+  } else if (0 == other.seen_count_) {
+    // nothing to merge
+  } else {
+    int64_t keep_cnt = samples_.count();
+    int64_t pick_cnt = other.samples_.count();
+    if (keep_cnt + pick_cnt > MAX_SAMPLE_COUNT) {
+      // each side keeps samples in proportion to the values it has seen
+      const double ratio = static_cast<double>(seen_count_) / static_cast<double>(seen_count_ + other.seen_count_);
+      keep_cnt = std::min(keep_cnt, static_cast<int64_t>(static_cast<double>(MAX_SAMPLE_COUNT) * ratio + 0.5));
+      pick_cnt = std::min(pick_cnt, MAX_SAMPLE_COUNT - keep_cnt);
+      keep_cnt = std::min(samples_.count(), MAX_SAMPLE_COUNT - pick_cnt);
+    }
+    if (OB_FAIL(shrink_samples_(keep_cnt))) {
+      LOG_WARN("failed to shrink samples", K(ret), K(keep_cnt), K(*this));
+    } else if (OB_FAIL(append_samples_(other, pick_cnt))) {
+      LOG_WARN("failed to append samples", K(ret), K(pick_cnt), K(other));
+    } else {
+      seen_count_ += other.seen_count_;
+    }
+  }
+  return ret;
+}
+
+int ObHistogramBuilder::build(const int64_t bucket_cnt, const int64_t num_distinct, ObOptColumnStat& stat)
+{
+  int ret = OB_SUCCESS;
+  ObArray<Group> groups;
+  const int64_t max_bucket_cnt = std::min(bucket_cnt, ObHistogram::MAX_NUM_BUCKETS);
+  bool is_built = false;
+  if (OB_UNLIKELY(max_bucket_cnt <= 0 || samples_.empty())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(bucket_cnt), K(*this));
+  } else if (FALSE_IT(std::sort(samples_.begin(), samples_.end(), SampleCompare()))) {
+  } else if (OB_FAIL(build_groups_(groups))) {
+    LOG_WARN("failed to build groups", K(ret));
+  } else {
+    const int64_t ndv = std::max(num_distinct, groups.count());
+    if (ndv <= max_bucket_cnt) {
+      if (OB_FAIL(build_frequency_(groups, stat))) {
+        LOG_WARN("failed to build frequency histogram", K(ret));
+      }
+    } else if (OB_FAIL(build_top_frequency_(groups, max_bucket_cnt, ndv, is_built, stat))) {
+      LOG_WARN("failed to build top frequency histogram", K(ret));
+    } else if (is_built) {
+      // done
+    } else if (OB_FAIL(build_hybrid_(groups, max_bucket_cnt, ndv, stat))) {
+      LOG_WARN("failed to build hybrid histogram", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObHistogramBuilder::store_sample_(const int64_t idx, const ObObj& value)
+{
+  int ret = OB_SUCCESS;
+  ObObj copied;
+  if (OB_UNLIKELY(idx < 0 || idx > samples_.count())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid sample idx", K(ret), K(idx), K(samples_.count()));
+  } else if (OB_FAIL(ob_write_obj(*cur_allocator_, value, copied))) {
+    LOG_WARN("failed to copy sample", K(ret), K(value));
+  } else if (idx == samples_.count()) {
+    if (OB_FAIL(samples_.push_back(copied))) {
+      LOG_WARN("failed to push back sample", K(ret));
+    } else {
+      live_size_ += copied.get_deep_copy_size();
+    }
+  } else {
+    live_size_ += copied.get_deep_copy_size() - samples_.at(idx).get_deep_copy_size();
+    samples_.at(idx) = copied;
+  }
+  if (OB_SUCC(ret) && OB_FAIL(compact_if_needed_())) {
+    LOG_WARN("failed to compact samples", K(ret));
+  }
+  return ret;
+}
+
+int ObHistogramBuilder::append_samples_(const ObHistogramBuilder& other, const int64_t pick_cnt)
+{
+  int ret = OB_SUCCESS;
+  const int64_t count = other.samples_.count();
+  int64_t need_cnt = pick_cnt;
+  // selection sampling, every sample of other is picked with the same probability
+  for (int64_t i = 0; OB_SUCC(ret) && need_cnt > 0 && i < count; ++i) {
+    if (random_.get(0, count - i - 1) < need_cnt) {
+      if (OB_FAIL(store_sample_(samples_.count(), other.samples_.at(i)))) {
+        LOG_WARN("failed to store sample", K(ret), K(i));
+      } else {
+        --need_cnt;
+      }
+    }
+  }
+  return ret;
+}
+
+int ObHistogramBuilder::shrink_samples_(const int64_t keep_cnt)
+{
+  int ret = OB_SUCCESS;
+  const int64_t count = samples_.count();
+  if (keep_cnt >= count) {
+    // keep all
+  } else {
+    int64_t need_cnt = keep_cnt;
+    int64_t keep_idx = 0;
+    live_size_ = 0;
+    for (int64_t i = 0; need_cnt > 0 && i < count; ++i) {
+      if (random_.get(0, count - i - 1) < need_cnt) {
+        samples_.at(keep_idx) = samples_.at(i);
+        live_size_ += samples_.at(keep_idx).get_deep_copy_size();
+        ++keep_idx;
+        --need_cnt;
+      }
+    }
+    while (samples_.count() > keep_idx) {
+      samples_.pop_back();
+    }
+    if (OB_FAIL(compact_if_needed_())) {
+      LOG_WARN("failed to compact samples", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObHistogramBuilder::compact_if_needed_()
+{
+  int ret = OB_SUCCESS;
+  if (cur_allocator_->used() <= std::max(COMPACT_MIN_SIZE, 4 * live_size_)) {
+    // most memory is still referenced by samples
+  } else {
+    ObObj copied;
+    next_allocator_->reuse();
+    for (int64_t i = 0; OB_SUCC(ret) && i < samples_.count(); ++i) {
+      if (OB_FAIL(ob_write_obj(*next_allocator_, samples_.at(i), copied))) {
+        LOG_WARN("failed to copy sample", K(ret), K(i));
+      } else {
+        samples_.at(i) = copied;
+      }
+    }
+    if (OB_SUCC(ret)) {
+      std::swap(cur_allocator_, next_allocator_);
+      next_allocator_->reuse();
+    }
+  }
+  return ret;
+}
+
+int ObHistogramBuilder::build_groups_(ObIArray<Group>& groups)
+{
+  int ret = OB_SUCCESS;
+  for (int64_t i = 0; OB_SUCC(ret) && i < samples_.count(); ++i) {
+    if (!groups.empty() && 0 == samples_.at(i).compare(samples_.at(groups.at(groups.count() - 1).idx_))) {
+      ++groups.at(groups.count() - 1).count_;
+    } else if (OB_FAIL(groups.push_back(Group(i, 1)))) {
+      LOG_WARN("failed to push back group", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObHistogramBuilder::build_frequency_(const ObIArray<Group>& groups, ObOptColumnStat& stat)
+{
+  int ret = OB_SUCCESS;
+  ObHistogram basic_info;
+  const double sample_size = static_cast<double>(samples_.count());
+  basic_info.set_type(ObHistogram::Type::FREQUENCY);
+  basic_info.set_bucket_cnt(groups.count());
+  basic_info.set_sample_size(sample_size);
+  // values not sampled are rarer than any sampled one
+  basic_info.set_density(0.5 / sample_size);
+  if (OB_FAIL(stat.init_histogram(basic_info))) {
+    LOG_WARN("failed to init histogram", K(ret));
+  } else {
+    int64_t endpoint_num = 0;
+    for (int64_t i = 0; OB_SUCC(ret) && i < groups.count(); ++i) {
+      endpoint_num += groups.at(i).count_;
+      if (OB_FAIL(stat.add_bucket(groups.at(i).count_, samples_.at(groups.at(i).idx_), endpoint_num))) {
+        LOG_WARN("failed to add bucket", K(ret), K(i));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObHistogramBuilder::build_top_frequency_(const ObIArray<Group>& groups, const int64_t bucket_cnt,
+    const int64_t num_distinct, bool& is_built, ObOptColumnStat& stat)
+{
+  int ret = OB_SUCCESS;
+  ObArray<Group> top_groups;
+  const int64_t sample_cnt = samples_.count();
+  is_built = false;
+  if (OB_FAIL(top_groups.assign(groups))) {
+    LOG_WARN("failed to assign groups", K(ret));
+  } else {
+    std::sort(top_groups.begin(), top_groups.end(), GroupCountCompare());
+    const int64_t top_cnt = std::min(bucket_cnt, top_groups.count());
+    int64_t covered_cnt = 0;
+    for (int64_t i = 0; i < top_cnt; ++i) {
+      covered_cnt += top_groups.at(i).count_;
+    }
+    if (covered_cnt * bucket_cnt < sample_cnt * (bucket_cnt - 1)) {
+      // top values do not cover the sample, use hybrid histogram
+    } else {
+      ObHistogram basic_info;
+      const double sample_size = static_cast<double>(sample_cnt);
+      const double rest_ndv = static_cast<double>(std::max(1L, num_distinct - top_cnt));
+      basic_info.set_type(ObHistogram::Type::TOP_FREQUENCY);
+      basic_info.set_bucket_cnt(top_cnt);
+      basic_info.set_sample_size(sample_size);
+      basic_info.set_density(covered_cnt == sample_cnt ? 0.5 / sample_size
+                                                       : (sample_cnt - covered_cnt) / sample_size / rest_ndv);
+      std::sort(top_groups.begin(), top_groups.begin() + top_cnt, GroupIdxCompare());
+      if (OB_FAIL(stat.init_histogram(basic_info))) {
+        LOG_WARN("failed to init histogram", K(ret));
+      } else {
+        int64_t endpoint_num = 0;
+        for (int64_t i = 0; OB_SUCC(ret) && i < top_cnt; ++i) {
+          endpoint_num += top_groups.at(i).count_;
+          if (OB_FAIL(stat.add_bucket(top_groups.at(i).count_, samples_.at(top_groups.at(i).idx_), endpoint_num))) {
+            LOG_WARN("failed to add bucket", K(ret), K(i));
+          }
+        }
+        is_built = OB_SUCC(ret);
+      }
+    }
+  }
+  return ret;
+}
+
+int ObHistogramBuilder::build_hybrid_(
+    const ObIArray<Group>& groups, const int64_t bucket_cnt, const int64_t num_distinct, ObOptColumnStat& stat)
+{
+  int ret = OB_SUCCESS;
+  ObHistogram basic_info;
+  const int64_t sample_cnt = samples_.count();
+  const double sample_size = static_cast<double>(sample_cnt);
+  // same as ObHistogram::bucket_is_popular
+  const double popular_limit = sample_size / static_cast<double>(bucket_cnt);
+  basic_info.set_type(ObHistogram::Type::HYBIRD);
+  basic_info.set_bucket_cnt(bucket_cnt);
+  basic_info.set_sample_size(sample_size);
+  if (OB_FAIL(stat.init_histogram(basic_info))) {
+    LOG_WARN("failed to init histogram", K(ret));
+  } else {
+    int64_t endpoint_num = 0;
+    int64_t last_endpoint_num = 0;
+    int64_t built_cnt = 0;
+    int64_t popular_cnt = 0;
+    int64_t popular_rows = 0;
+    for (int64_t i = 0; OB_SUCC(ret) && i < groups.count(); ++i) {
+      const Group& group = groups.at(i);
+      endpoint_num += group.count_;
+      // a value never spans buckets, the remaining rows are spread over the remaining buckets
+      const int64_t bucket_size = (sample_cnt - last_endpoint_num) / (bucket_cnt - built_cnt);
+      if (i != groups.count() - 1 && endpoint_num - last_endpoint_num < bucket_size) {
+        // not an endpoint
+      } else if (OB_FAIL(stat.add_bucket(group.count_, samples_.at(group.idx_), endpoint_num))) {
+        LOG_WARN("failed to add bucket", K(ret), K(i));
+      } else {
+        last_endpoint_num = endpoint_num;
+        ++built_cnt;
+        if (static_cast<double>(group.count_) > popular_limit) {
+          ++popular_cnt;
+          popular_rows += group.count_;
+        }
+      }
+    }
+    if (OB_SUCC(ret) && OB_NOT_NULL(stat.get_histogram())) {
+      const double rest_ndv = static_cast<double>(std::max(1L, num_distinct - popular_cnt));
+      stat.get_histogram()->set_density((sample_cnt - popular_rows) / sample_size / rest_ndv);
+    }
+  }
+  return ret;
+}
+
+}  // namespace common
+}  // namespace oceanbase
@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef _OB_HISTOGRAM_BUILDER_H_
+#define _OB_HISTOGRAM_BUILDER_H_
+
+#include "lib/allocator/page_arena.h"
+#include "lib/container/ob_array.h"
+#include "lib/random/ob_random.h"
+#include "common/object/ob_object.h"
+#include "share/stat/ob_opt_column_stat.h"
+
+namespace oceanbase {
+namespace common {
+
+/*
+ * Builds the histogram of one column from a uniform sample of its non-null values.
+ *
+ * > Values are kept in a reservoir of MAX_SAMPLE_COUNT, builders of parallel merge tasks are merged
+ *   with their share of seen values, so the merged reservoir is still a uniform sample.
+ * > Values larger than MAX_SAMPLE_VALUE_SIZE are counted but never sampled, they can not be bucket endpoints.
+ * > build() chooses FREQUENCY if every distinct value gets a bucket, TOP_FREQUENCY if the top values cover
+ *   the sample except one bucket, HYBIRD otherwise. Endpoint numbers are cumulative as __all_histogram_stat
+ *   stores them.
+ */
+class ObHistogramBuilder {
+public:
+  static const int64_t MAX_SAMPLE_COUNT = 2048;
+  static const int64_t MAX_SAMPLE_VALUE_SIZE = 256;
+
+public:
+  ObHistogramBuilder();
+  ~ObHistogramBuilder();
+  void reset();
+  int add_value(const ObObj& value);
+  int merge(const ObHistogramBuilder& other);
+  // num_distinct is the estimated NDV of the whole column, the histogram is put into stat
+  int build(const int64_t bucket_cnt, const int64_t num_distinct, ObOptColumnStat& stat);
+
+  int64_t get_sample_count() const
+  {
+    return samples_.count();
+  }
+  int64_t get_seen_count() const
+  {
+    return seen_count_;
+  }
+  TO_STRING_KV(K_(seen_count), "sample_count", samples_.count(), K_(live_size));
+
+private:
+  struct Group {
+    Group() : idx_(0), count_(0)
+    {}
+    Group(const int64_t idx, const int64_t count) : idx_(idx), count_(count)
+    {}
+    TO_STRING_KV(K_(idx), K_(count));
+    int64_t idx_;  // first sample of the value
+    int64_t count_;
+  };
+  struct GroupCountCompare {
+    bool operator()(const Group& left, const Group& right) const
+    {
+      return left.count_ > right.count_ || (left.count_ == right.count_ && left.idx_ < right.idx_);
+    }
+  };
+  struct GroupIdxCompare {
+    bool operator()(const Group& left, const Group& right) const
+    {
+      return left.idx_ < right.idx_;
+    }
+  };
+
+private:
+  int store_sample_(const int64_t idx, const ObObj& value);
+  int append_samples_(const ObHistogramBuilder& other, const int64_t pick_cnt);
+  int shrink_samples_(const int64_t keep_cnt);
+  int compact_if_needed_();
+  int build_groups_(ObIArray<Group>& groups);
+  int build_frequency_(const ObIArray<Group>& groups, ObOptColumnStat& stat);
+  int build_top_frequency_(const ObIArray<Group>& groups, const int64_t bucket_cnt, const int64_t num_distinct,
+      bool& is_built, ObOptColumnStat& stat);
+  int build_hybrid_(const ObIArray<Group>& groups, const int64_t bucket_cnt, const int64_t num_distinct,
+      ObOptColumnStat& stat);
+
+private:
+  // samples are copied into cur_allocator_, live samples are moved to next_allocator_ to drop the replaced ones
+  ObArenaAllocator allocator_;
+  ObArenaAllocator compact_allocator_;
+  ObArenaAllocator* cur_allocator_;
+  ObArenaAllocator* next_allocator_;
+  ObArray<ObObj> samples_;
+  int64_t seen_count_;
+  int64_t live_size_;
+  ObRandom random_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObHistogramBuilder);
+};
+
+}  // namespace common
+}  // namespace oceanbase
+
+#endif /* _OB_HISTOGRAM_BUILDER_H_ */
@@ -104,6 +104,7 @@ ObOptColumnStat::ObOptColumnStat()
       object_buf_(nullptr),
       histogram_(nullptr),
       last_analyzed_(0),
+      is_merge_built_(false),
       allocator_(nullptr)
 {
   min_value_.set_min_value();
@@ -123,6 +124,7 @@ ObOptColumnStat::ObOptColumnStat(ObIAllocator& allocator)
       object_buf_(nullptr),
       histogram_(nullptr),
       last_analyzed_(0),
+      is_merge_built_(false),
       allocator_(&allocator)
 {
   min_value_.set_min_value();
@@ -205,6 +207,8 @@ int ObOptColumnStat::deep_copy(const ObOptColumnStat& src, char* buf, const int6
   object_type_ = src.object_type_;
   num_null_ = src.num_null_;
   num_distinct_ = src.num_distinct_;
+  last_analyzed_ = src.last_analyzed_;
+  is_merge_built_ = src.is_merge_built_;
 
   if (!src.is_valid() || nullptr == buf || size <= 0) {
     ret = OB_INVALID_ARGUMENT;
@@ -310,6 +314,46 @@ int ObHistogram::get_density_between_range(const ObObj& startobj, const ObObj& e
   return ret;
 }
 
+int ObHistogram::get_equal_density(const ObObj& value, const ObDataTypeCastParams& dtc_params, double& density) const
+{
+  int ret = OB_SUCCESS;
+  int64_t idx = OB_INVALID_INDEX;
+  int64_t cmp = 0;
+  bool is_popular = false;
+  density = get_density();
+  if (OB_FAIL(get_bucket_bound_idx(value, BoundType::LOWER, dtc_params, idx))) {
+    LOG_WARN("failed to get bucket bound idx", K(ret));
+  } else if (idx < 0 || idx >= buckets_.count()) {
+    // out of the histogram
+  } else if (OB_ISNULL(buckets_.at(idx))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("bucket is null", K(ret), K(idx));
+  } else if (OB_FAIL(compare_bound(value, buckets_.at(idx)->endpoint_value_, dtc_params, cmp))) {
+    LOG_WARN("failed to compare bound", K(ret));
+  } else if (0 != cmp) {
+    // not an endpoint
+  } else if (OB_FAIL(bucket_is_popular(*buckets_.at(idx), is_popular))) {
+    LOG_WARN("failed to check popular", K(ret));
+  } else if (is_popular || Type::FREQUENCY == type_) {
+    double total = 0;
+    for (int64_t i = 0; OB_SUCC(ret) && i < buckets_.count(); ++i) {
+      if (OB_ISNULL(buckets_.at(i))) {
+        ret = OB_INVALID_ARGUMENT;
+        LOG_WARN("bucket is null", K(ret), K(i));
+      } else {
+        total += static_cast<double>(buckets_.at(i)->endpoint_num_);
+      }
+    }
+    if (OB_SUCC(ret) && total > 0) {
+      // endpoint_num_ of hybrid bucket counts the whole bucket, only the repeat count is the endpoint value
+      const Bucket& bkt = *buckets_.at(idx);
+      const int64_t rows = Type::HYBIRD == type_ ? bkt.endpoint_repeat_count_ : bkt.endpoint_num_;
+      density = static_cast<double>(rows) / total;
+    }
+  }
+  return ret;
+}
+
 int ObHistogram::bucket_is_popular(const Bucket& bkt, bool& is_popular) const
 {
   int ret = OB_SUCCESS;
@@ -320,8 +364,13 @@ int ObHistogram::bucket_is_popular(const Bucket& bkt, bool& is_popular) const
       is_popular = bkt.endpoint_num_ > 1;
       break;
     }
+    case Type::TOP_FREQUENCY: {
+      // every bucket holds one of the top values
+      is_popular = true;
+      break;
+    }
     case Type::HYBIRD: {
-      // is_popular = bkt.repeat_count_ > (get_sample_size() / get_bucket_count());
+      is_popular = bucket_cnt_ > 0 && static_cast<double>(bkt.endpoint_repeat_count_) > sample_size_ / bucket_cnt_;
       break;
     }
     default: {
@@ -338,7 +387,15 @@ int ObHistogram::compare_bound(
 {
   int ret = OB_SUCCESS;
   ObObjType compare_type;
-  if (OB_FAIL(ObExprResultTypeUtil::get_relational_cmp_type(compare_type, left_obj.get_type(), right_obj.get_type()))) {
+  if (left_obj.is_min_value() || left_obj.is_max_value() || right_obj.is_min_value() || right_obj.is_max_value()) {
+    // bounds of half open ranges
+    if (left_obj.get_type() == right_obj.get_type()) {
+      result = 0;
+    } else {
+      result = (left_obj.is_min_value() || right_obj.is_max_value()) ? -1 : 1;
+    }
+  } else if (OB_FAIL(ObExprResultTypeUtil::get_relational_cmp_type(
+                 compare_type, left_obj.get_type(), right_obj.get_type()))) {
     LOG_WARN("failed to get compare type", K(ret));
   } else {
     ObArenaAllocator arena(ObModIds::OB_BUFFER);
@@ -444,6 +501,7 @@ int ObOptColumnStat::init_histogram(const ObHistogram& basic_histogram_info)
     LOG_WARN("histogram is still NULL after initialization", K(ret), K_(histogram));
   } else {
     histogram_->type_ = basic_histogram_info.type_;
+    histogram_->sample_size_ = basic_histogram_info.sample_size_;
     histogram_->bucket_cnt_ = basic_histogram_info.bucket_cnt_;
     histogram_->density_ = basic_histogram_info.density_;
   }
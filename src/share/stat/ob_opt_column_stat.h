@@ -132,6 +132,9 @@ public:
   int get_density_between_range(const ObObj& startobj, const ObObj& endobj, const ObBorderFlag& border,
       const ObDataTypeCastParams& dtc_params, double& range_density) const;
 
+  // rows equal to value / total_rows_in_histogram, density_ if value is not a popular endpoint
+  int get_equal_density(const ObObj& value, const ObDataTypeCastParams& dtc_params, double& density) const;
+
   int bucket_is_popular(const Bucket& bkt, bool& is_popular) const;
   TO_STRING_KV(K_(type), K_(sample_size), K_(bucket_cnt), K_(buckets));
 
@@ -146,6 +149,9 @@ protected:
 class ObOptColumnStat : public common::ObIKVCacheValue {
 public:
   static const int64_t MAX_OBJECT_SERIALIZE_SIZE = 512;
+  // major merge keeps no NDV synopsis, it stores this value in distinct_cnt_synopsis_size
+  // to tell the stats it built from the ones gathered by ANALYZE.
+  static const int64_t MERGE_BUILT_SYNOPSIS_SIZE = -1;
   typedef ObHistogram::Bucket Bucket;
   typedef ObHistogram::Type HistogramType;
   struct Key : public common::ObIKVCacheKey {
@@ -283,6 +289,22 @@ public:
   {
     table_id_ = tid;
   }
+  int64_t get_last_analyzed() const
+  {
+    return last_analyzed_;
+  }
+  void set_last_analyzed(int64_t last_analyzed)
+  {
+    last_analyzed_ = last_analyzed;
+  }
+  bool is_merge_built() const
+  {
+    return is_merge_built_;
+  }
+  void set_merge_built(bool is_merge_built)
+  {
+    is_merge_built_ = is_merge_built;
+  }
   // check ObOptColumnStat Object if allocates object buffer for write.
   bool is_writable() const
   {
@@ -319,7 +341,7 @@ public:
   }
 
   TO_STRING_KV(K_(table_id), K_(partition_id), K_(column_id), K_(object_type), K_(num_distinct), K_(num_null),
-      K_(min_value), K_(max_value));
+      K_(min_value), K_(max_value), K_(last_analyzed), K_(is_merge_built));
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObOptColumnStat);
@@ -337,6 +359,7 @@ protected:
   char* object_buf_;
   ObHistogram* histogram_;
   int64_t last_analyzed_;
+  bool is_merge_built_;
   ObIAllocator* const allocator_;
 };
 
@@ -109,6 +109,22 @@ int ObOptStatManager::add_refresh_stat_task(const obrpc::ObUpdateStatCacheArg& a
   return ret;
 }
 
+int ObOptStatManager::add_update_histogram_task(
+    const ObIArray<ObOptColumnStat*>& column_stats, const int64_t snapshot_version)
+{
+  int ret = OB_SUCCESS;
+  ObUpdateHistogramTask update_task(this);
+  if (!inited_) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("optimizer statistics manager has not been initialized.", K(ret));
+  } else if (OB_FAIL(update_task.init(column_stats, snapshot_version))) {
+    LOG_WARN("initialize update histogram task failed. ", K(ret));
+  } else if (OB_FAIL(refresh_stat_task_queue_.add_task(update_task))) {
+    LOG_WARN("add update histogram task to task queue failed. ", K(ret));
+  }
+  return ret;
+}
+
 int ObOptStatManager::get_column_stat(const ObOptColumnStat::Key& key, ObOptColumnStatHandle& handle)
 {
   int ret = OB_SUCCESS;
@@ -124,6 +140,23 @@ int ObOptStatManager::get_column_stat(const ObOptColumnStat::Key& key, ObOptColu
   return ret;
 }
 
+int ObOptStatManager::get_column_stat_from_cache(const ObOptColumnStat::Key& key, ObOptColumnStatHandle& handle)
+{
+  int ret = OB_SUCCESS;
+  if (!inited_) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("stat manager has not been initialized.", K(ret));
+  } else if (!key.is_valid()) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid column stat key.", K(key), K(ret));
+  } else if (OB_FAIL(stat_service_->get_column_stat_from_cache(key, handle))) {
+    if (OB_ENTRY_NOT_EXIST != ret) {
+      LOG_WARN("get column stat from cache failed.", K(key), K(ret));
+    }
+  }
+  return ret;
+}
+
 int ObOptStatManager::get_table_stat(const ObOptTableStat::Key& key, ObOptTableStat& tstat)
 {
   int ret = OB_SUCCESS;
@@ -231,5 +264,132 @@ IObDedupTask* ObOptStatManager::ObRefreshStatTask::deep_copy(char* buffer, const
   return task;
 }
 
+ObOptStatManager::ObUpdateHistogramTask::~ObUpdateHistogramTask()
+{
+  if (is_deep_copied_) {
+    // copies live in the task buffer, only the bucket arrays of their histograms own memory
+    for (int64_t i = 0; i < column_stats_.count(); ++i) {
+      if (OB_NOT_NULL(column_stats_.at(i)) && OB_NOT_NULL(column_stats_.at(i)->get_histogram())) {
+        column_stats_.at(i)->get_histogram()->~ObHistogram();
+      }
+    }
+  }
+}
+
+int ObOptStatManager::ObUpdateHistogramTask::init(
+    const ObIArray<ObOptColumnStat*>& column_stats, const int64_t snapshot_version)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(column_stats.empty() || snapshot_version <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(column_stats.count()), K(snapshot_version));
+  } else if (OB_FAIL(column_stats_.assign(column_stats))) {
+    LOG_WARN("failed to assign column stats", K(ret));
+  } else {
+    snapshot_version_ = snapshot_version;
+  }
+  return ret;
+}
+
+int64_t ObOptStatManager::ObUpdateHistogramTask::get_deep_copy_size() const
+{
+  int64_t size = sizeof(*this);
+  for (int64_t i = 0; i < column_stats_.count(); ++i) {
+    if (OB_NOT_NULL(column_stats_.at(i))) {
+      size += upper_align(column_stats_.at(i)->size(), sizeof(int64_t));
+    }
+  }
+  return size;
+}
+
+IObDedupTask* ObOptStatManager::ObUpdateHistogramTask::deep_copy(char* buffer, const int64_t buf_size) const
+{
+  int ret = OB_SUCCESS;
+  ObUpdateHistogramTask* task = nullptr;
+  if (OB_ISNULL(buffer) || OB_UNLIKELY(buf_size < get_deep_copy_size())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument, buffer is NULL. ", K(ret));
+  } else {
+    int64_t pos = sizeof(*this);
+    task = new (buffer) ObUpdateHistogramTask(stat_manager_);
+    task->snapshot_version_ = snapshot_version_;
+    task->is_deep_copied_ = true;
+    for (int64_t i = 0; OB_SUCC(ret) && i < column_stats_.count(); ++i) {
+      ObIKVCacheValue* value = nullptr;
+      if (OB_ISNULL(column_stats_.at(i))) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("column stat should not be NULL.", K(ret), K(i));
+      } else if (OB_FAIL(column_stats_.at(i)->deep_copy(buffer + pos, buf_size - pos, value))) {
+        LOG_WARN("deep copy column stat failed. ", K(ret), K(i));
+      } else if (OB_FAIL(task->column_stats_.push_back(static_cast<ObOptColumnStat*>(value)))) {
+        LOG_WARN("push back column stat failed. ", K(ret));
+      } else {
+        pos += upper_align(column_stats_.at(i)->size(), sizeof(int64_t));
+      }
+    }
+    if (OB_FAIL(ret)) {
+      task->~ObUpdateHistogramTask();
+      task = nullptr;
+    }
+  }
+  return task;
+}
+
+// histograms gathered by ANALYZE are kept, and so are the ones gathered after the data this merge read
+bool ObOptStatManager::ObUpdateHistogramTask::need_update(const ObOptColumnStat& stored_stat) const
+{
+  const int64_t last_analyzed = stored_stat.get_last_analyzed();
+  return last_analyzed <= 0 || (stored_stat.is_merge_built() && last_analyzed < snapshot_version_);
+}
+
+int ObOptStatManager::ObUpdateHistogramTask::process()
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObOptColumnStat*, 16> update_stats;
+  if (OB_ISNULL(stat_manager_) || OB_ISNULL(stat_manager_->stat_service_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("stat manager should not be NULL.", K(ret));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < column_stats_.count(); ++i) {
+    ObOptColumnStat* column_stat = column_stats_.at(i);
+    ObOptColumnStatHandle handle;
+    if (OB_ISNULL(column_stat)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("column stat should not be NULL.", K(ret), K(i));
+    } else {
+      ObOptColumnStat::Key key(
+          column_stat->get_table_id(), column_stat->get_partition_id(), column_stat->get_column_id());
+      // read the stored stat instead of the cached one, which may predate a recent ANALYZE
+      if (OB_FAIL(stat_manager_->stat_service_->load_column_stat_and_put_cache(key, handle))) {
+        LOG_WARN("load column stat failed", K(ret), K(key));
+      } else if (OB_ISNULL(handle.stat_)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("column stat handle is NULL", K(ret), K(key));
+      } else if (!need_update(*handle.stat_)) {
+        LOG_INFO("skip histogram of merge", K(key), K_(snapshot_version), "stored_stat", *handle.stat_);
+      } else if (OB_FAIL(update_stats.push_back(column_stat))) {
+        LOG_WARN("push back column stat failed", K(ret));
+      }
+    }
+  }
+  if (OB_SUCC(ret) && update_stats.count() > 0) {
+    if (OB_FAIL(stat_manager_->update_column_stat(update_stats))) {
+      LOG_WARN("update column stat with histograms failed", K(ret));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < update_stats.count(); ++i) {
+      const ObOptColumnStat* column_stat = update_stats.at(i);
+      ObOptColumnStat::Key key(
+          column_stat->get_table_id(), column_stat->get_partition_id(), column_stat->get_column_id());
+      if (OB_FAIL(stat_manager_->refresh_column_stat(key))) {
+        LOG_WARN("refresh column stat failed", K(ret), K(key));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      LOG_INFO("finish update histograms of merge", "column_count", update_stats.count(), K_(snapshot_version));
+    }
+  }
+  return ret;
+}
+
 }  // namespace common
 }  // namespace oceanbase
@@ -48,6 +48,8 @@ public:
   {}
   virtual int init(ObOptStatService* stat_service, ObMySQLProxy* proxy, ObServerConfig* config);
   virtual int get_column_stat(const ObOptColumnStat::Key& key, ObOptColumnStatHandle& handle);
+  // cache lookup only, returns OB_ENTRY_NOT_EXIST on miss instead of loading from inner table
+  virtual int get_column_stat_from_cache(const ObOptColumnStat::Key& key, ObOptColumnStatHandle& handle);
   virtual int update_column_stat(const common::ObIArray<ObOptColumnStat*>& column_stats);
   virtual int delete_column_stat(const common::ObIArray<ObOptColumnStat*>& column_stats);
   virtual int refresh_column_stat(const ObOptColumnStat::Key& key);
@@ -55,6 +57,8 @@ public:
 
   virtual int get_table_stat(const ObOptTableStat::Key& key, ObOptTableStat& tstat);
   virtual int add_refresh_stat_task(const obrpc::ObUpdateStatCacheArg& analyze_arg);
+  virtual int add_update_histogram_task(
+      const common::ObIArray<ObOptColumnStat*>& column_stats, const int64_t snapshot_version);
   static ObOptTableStat& get_default_table_stat();
   static ObOptStatManager& get_instance()
   {
@@ -101,6 +105,45 @@ public:
     obrpc::ObUpdateStatCacheArg analyze_arg_;
   };
 
+  // writes the column stats built by major merge, the column stats are deep copied into the task
+  class ObUpdateHistogramTask : public common::IObDedupTask {
+  public:
+    explicit ObUpdateHistogramTask(ObOptStatManager* manager)
+        : common::IObDedupTask(T_UPDATE_OPT_HISTOGRAM),
+          stat_manager_(manager),
+          snapshot_version_(0),
+          is_deep_copied_(false),
+          column_stats_()
+    {}
+    virtual ~ObUpdateHistogramTask();
+    virtual int64_t hash() const override
+    {
+      return 0;
+    }
+    virtual bool operator==(const common::IObDedupTask& other) const override
+    {
+      UNUSED(other);
+      return false;
+    }
+    virtual int64_t get_deep_copy_size() const override;
+    virtual common::IObDedupTask* deep_copy(char* buffer, const int64_t buf_size) const override;
+    virtual int64_t get_abs_expired_time() const override
+    {
+      return 0;
+    }
+    virtual int process() override;
+    int init(const common::ObIArray<ObOptColumnStat*>& column_stats, const int64_t snapshot_version);
+
+  protected:
+    bool need_update(const ObOptColumnStat& stored_stat) const;
+
+  protected:
+    ObOptStatManager* stat_manager_;
+    int64_t snapshot_version_;
+    bool is_deep_copied_;
+    common::ObSEArray<ObOptColumnStat*, 16> column_stats_;
+  };
+
 protected:
   static const int64_t REFRESH_STAT_TASK_NUM = 5;
   bool inited_;
@@ -79,6 +79,23 @@ int ObOptStatService::get_column_stat(const ObOptColumnStat::Key& key, ObOptColu
   return ret;
 }
 
+int ObOptStatService::get_column_stat_from_cache(const ObOptColumnStat::Key& key, ObOptColumnStatHandle& handle)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("statistics service is not initialized. ", K(ret), K(key));
+  } else if (OB_FAIL(column_stat_cache_.get_row(key, handle))) {
+    if (OB_ENTRY_NOT_EXIST != ret) {
+      LOG_WARN("get column stat from cache failed", K(ret), K(key));
+    }
+  } else if (OB_ISNULL(handle.stat_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("cache hit but value is NULL. BUG here.", K(ret), K(key));
+  }
+  return ret;
+}
+
 int ObOptStatService::load_table_stat_and_put_cache(const ObOptTableStat::Key& key, ObOptTableStatHandle& handle)
 {
   int ret = OB_SUCCESS;
@@ -27,6 +27,7 @@ public:
   virtual int init(common::ObMySQLProxy* proxy, ObServerConfig* config);
   virtual int get_table_stat(const ObOptTableStat::Key& key, ObOptTableStat& tstat);
   virtual int get_column_stat(const ObOptColumnStat::Key& key, ObOptColumnStatHandle& handle);
+  virtual int get_column_stat_from_cache(const ObOptColumnStat::Key& key, ObOptColumnStatHandle& handle);
   virtual int load_column_stat_and_put_cache(const ObOptColumnStat::Key& key, ObOptColumnStatHandle& handle);
   virtual int load_table_stat_and_put_cache(const ObOptTableStat::Key& key, ObOptTableStatHandle& handle);
 
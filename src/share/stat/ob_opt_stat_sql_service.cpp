@@ -65,9 +65,14 @@
   "null_cnt,"                       \
   "max_value, "                     \
   "min_value,"                      \
+  "b_max_value, "                   \
+  "b_min_value,"                    \
   "histogram_type,"                 \
   "bucket_cnt,"                     \
-  "density"
+  "sample_size,"                    \
+  "density,"                        \
+  "last_analyzed,"                  \
+  "distinct_cnt_synopsis_size"
 
 #define ALL_COLUMN_STATISTICS "__all_column_stat"
 #define ALL_TABLE_STATISTICS "__all_table_stat"
@@ -277,7 +282,7 @@ int ObOptStatSqlService::update_column_stat(const ObIArray<ObOptColumnStat*>& co
       if (OB_ISNULL(column_stats.at(i))) {
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("get unexpected null", K(column_stats.at(i)), K(ret));
-      } else if (OB_FAIL(get_column_stat_sql(*column_stats.at(i), current_time, temp_sql))) {
+      } else if (OB_FAIL(get_column_stat_sql(*column_stats.at(i), current_time, allocator, temp_sql))) {
         LOG_WARN("failed to get column stat", K(ret));
       } else if (OB_FAIL(column_stat_sql.append_fmt(
                      "(%s)%s", temp_sql.ptr(), (i == column_stats.count() - 1 ? ";" : ",")))) {
@@ -492,7 +497,7 @@ int ObOptStatSqlService::get_table_stat_sql(
 }
 
 int ObOptStatSqlService::get_column_stat_sql(
-    const ObOptColumnStat& stat, const int64_t current_time, ObSqlString& sql_string)
+    const ObOptColumnStat& stat, const int64_t current_time, ObIAllocator& allocator, ObSqlString& sql_string)
 {
   int ret = OB_SUCCESS;
   share::ObDMLSqlSplicer dml_splicer;
@@ -500,21 +505,37 @@ int ObOptStatSqlService::get_column_stat_sql(
   uint64_t tenant_id = extract_tenant_id(table_id);
   uint64_t ext_tenant_id = ObSchemaUtils::get_extract_tenant_id(tenant_id, tenant_id);
   uint64_t pure_table_id = ObSchemaUtils::get_extract_schema_id(tenant_id, table_id);
+  ObString min_value;
+  ObString b_min_value;
+  ObString max_value;
+  ObString b_max_value;
   if (OB_ISNULL(stat.get_histogram())) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("null histogram", K(ret));
+  } else if (!stat.get_min_value().is_min_value() &&
+             (OB_FAIL(get_obj_str(stat.get_min_value(), allocator, min_value)) ||
+                 OB_FAIL(get_obj_binary_hex_str(stat.get_min_value(), allocator, b_min_value)))) {
+    LOG_WARN("failed to convert min value to string", K(ret), K(stat));
+  } else if (!stat.get_max_value().is_max_value() &&
+             (OB_FAIL(get_obj_str(stat.get_max_value(), allocator, max_value)) ||
+                 OB_FAIL(get_obj_binary_hex_str(stat.get_max_value(), allocator, b_max_value)))) {
+    LOG_WARN("failed to convert max value to string", K(ret), K(stat));
   } else if (OB_FAIL(dml_splicer.add_pk_column("tenant_id", ext_tenant_id)) ||
              OB_FAIL(dml_splicer.add_pk_column("table_id", pure_table_id)) ||
              OB_FAIL(dml_splicer.add_pk_column("partition_id", stat.get_partition_id())) ||
              OB_FAIL(dml_splicer.add_pk_column("column_id", stat.get_column_id())) ||
              OB_FAIL(dml_splicer.add_column("object_type", stat.get_stat_level())) ||
              OB_FAIL(dml_splicer.add_time_column("last_analyzed", current_time)) ||
-             OB_FAIL(dml_splicer.add_column("distinct_cnt", 0)) || OB_FAIL(dml_splicer.add_column("null_cnt", 0)) ||
-             OB_FAIL(dml_splicer.add_column("max_value", "")) || OB_FAIL(dml_splicer.add_column("b_max_value", "")) ||
-             OB_FAIL(dml_splicer.add_column("min_value", "")) || OB_FAIL(dml_splicer.add_column("b_min_value", "")) ||
+             OB_FAIL(dml_splicer.add_column("distinct_cnt", stat.get_num_distinct())) ||
+             OB_FAIL(dml_splicer.add_column("null_cnt", stat.get_num_null())) ||
+             OB_FAIL(dml_splicer.add_column("max_value", ObHexEscapeSqlStr(max_value))) ||
+             OB_FAIL(dml_splicer.add_column("b_max_value", b_max_value)) ||
+             OB_FAIL(dml_splicer.add_column("min_value", ObHexEscapeSqlStr(min_value))) ||
+             OB_FAIL(dml_splicer.add_column("b_min_value", b_min_value)) ||
              OB_FAIL(dml_splicer.add_column("avg_len", 0)) ||
              OB_FAIL(dml_splicer.add_column("distinct_cnt_synopsis", "")) ||
-             OB_FAIL(dml_splicer.add_column("distinct_cnt_synopsis_size", 0)) ||
+             OB_FAIL(dml_splicer.add_column("distinct_cnt_synopsis_size",
+                 stat.is_merge_built() ? ObOptColumnStat::MERGE_BUILT_SYNOPSIS_SIZE : 0)) ||
              OB_FAIL(dml_splicer.add_column("sample_size", stat.get_histogram()->get_sample_size())) ||
              OB_FAIL(dml_splicer.add_column("density", stat.get_histogram()->get_density())) ||
              OB_FAIL(dml_splicer.add_column("bucket_cnt", stat.get_histogram()->get_bucket_cnt())) ||
@@ -755,6 +776,7 @@ int ObOptStatSqlService::fill_column_stat(const uint64_t table_id, common::sqlcl
   int ret = OB_SUCCESS;
   uint64_t tenant_id = 0;
   ObHistogram::Type histogram_type = ObHistogram::Type::INVALID_TYPE;
+  int64_t synopsis_size = 0;
   if (!inited_) {
     ret = OB_NOT_INIT;
     LOG_WARN("sql service has not been initialized.", K(ret));
@@ -769,28 +791,40 @@ int ObOptStatSqlService::fill_column_stat(const uint64_t table_id, common::sqlcl
   EXTRACT_INT_FIELD_MYSQL(result, "histogram_type", histogram_type, ObHistogram::Type);
   EXTRACT_INT_FIELD_TO_CLASS_MYSQL(result, bucket_cnt, basic_histogram_info, int64_t);
   EXTRACT_DOUBLE_FIELD_TO_CLASS_MYSQL(result, density, basic_histogram_info, double);
+  EXTRACT_DOUBLE_FIELD_TO_CLASS_MYSQL_WITH_DEFAULT_VALUE(
+      result, sample_size, basic_histogram_info, double, true, false, 0);
+  EXTRACT_INT_FIELD_MYSQL_WITH_DEFAULT_VALUE(
+      result, "distinct_cnt_synopsis_size", synopsis_size, int64_t, true, false, 0);
 
   if (OB_SUCC(ret)) {
-    basic_histogram_info.set_type(histogram_type);
+    int64_t last_analyzed = 0;
+    if (OB_FAIL(result.get_timestamp("last_analyzed", NULL, last_analyzed))) {
+      LOG_WARN("fail to get column in row. ", "column_name", "last_analyzed", K(ret));
+    } else {
+      basic_histogram_info.set_type(histogram_type);
+      stat.set_last_analyzed(last_analyzed);
+      stat.set_merge_built(ObOptColumnStat::MERGE_BUILT_SYNOPSIS_SIZE == synopsis_size);
+    }
   }
 
+  ObArenaAllocator arena(ObModIds::OB_BUFFER);
   ObString str_field;
   common::ObObj obj;
-  int64_t pos = 0;
 
-  EXTRACT_VARCHAR_FIELD_MYSQL(result, "min_value", str_field);
-  if (OB_SUCC(ret)) {
-    if (OB_FAIL(obj.deserialize(str_field.ptr(), str_field.length(), pos))) {
+  // min/max value without statistics is stored as empty string
+  EXTRACT_VARCHAR_FIELD_MYSQL_SKIP_RET(result, "b_min_value", str_field);
+  if (OB_SUCC(ret) && !str_field.empty()) {
+    if (OB_FAIL(hex_str_to_obj(str_field.ptr(), str_field.length(), arena, obj))) {
       LOG_WARN("deserialize_hex_cstr min value failed.", K(stat), K(ret));
     } else if (OB_FAIL(stat.store_min_value(obj))) {
       LOG_WARN("store min value failed.", K(stat), K(ret));
     }
   }
 
-  EXTRACT_VARCHAR_FIELD_MYSQL(result, "max_value", str_field);
-  if (OB_SUCC(ret)) {
-    pos = 0;
-    if (OB_FAIL(obj.deserialize(str_field.ptr(), str_field.length(), pos))) {
+  str_field.reset();
+  EXTRACT_VARCHAR_FIELD_MYSQL_SKIP_RET(result, "b_max_value", str_field);
+  if (OB_SUCC(ret) && !str_field.empty()) {
+    if (OB_FAIL(hex_str_to_obj(str_field.ptr(), str_field.length(), arena, obj))) {
       LOG_WARN("deserialize_hex_cstr max value failed.", K(stat), K(ret));
     } else if (OB_FAIL(stat.store_max_value(obj))) {
       LOG_WARN("store max value failed.", K(stat), K(ret));
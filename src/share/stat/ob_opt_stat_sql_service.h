@@ -50,7 +50,8 @@ public:
 
 private:
   int get_table_stat_sql(const ObOptColumnStat& stat, const int64_t current_time, ObSqlString& sql_string);
-  int get_column_stat_sql(const ObOptColumnStat& stat, const int64_t current_time, ObSqlString& sql_string);
+  int get_column_stat_sql(const ObOptColumnStat& stat, const int64_t current_time, common::ObIAllocator& allocator,
+      ObSqlString& sql_string);
   int get_histogram_stat_sql(const ObOptColumnStat& stat, common::ObIAllocator& allocator,
       ObOptColumnStat::Bucket& bucket, ObSqlString& sql_string);
   int get_obj_str(const common::ObObj& obj, common::ObIAllocator& allocator, common::ObString& out_str);
@@ -135,6 +135,81 @@ void ObAggregateProcessor::AggrCell::destroy()
   curr_row_results_.reset();
 }
 
+// Numbers with at most SCALED_NUMBER_MAX_SCALE decimal digits are summed as int64 scaled by
+// 10^scale in tiny num of AggrCell, ObNumber is used only on overflow and when collecting result.
+static const int64_t SCALED_NUMBER_MAX_SCALE = ObNumber::DIGIT_LEN;
+static const int64_t POWER_OF_TEN[SCALED_NUMBER_MAX_SCALE + 1] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+
+bool ObAggregateProcessor::get_scaled_number_scale(const ObAggrInfo& aggr_info, int64_t& scale)
+{
+  scale = aggr_info.param_exprs_.at(0)->datum_meta_.scale_;
+  return scale >= 0 && scale <= SCALED_NUMBER_MAX_SCALE;
+}
+
+// return false if %nmb has more than %scale decimal digits or value * 10^scale overflows int64
+bool ObAggregateProcessor::number_to_scaled_int(const ObNumber& nmb, const int64_t scale, int64_t& value)
+{
+  bool bret = true;
+  value = 0;
+  if (!nmb.is_zero()) {
+    const uint64_t scale_unit = POWER_OF_TEN[scale];
+    const uint64_t decimal_unit = POWER_OF_TEN[ObNumber::DIGIT_LEN - scale];
+    const uint64_t max_int_parts = INT64_MAX / scale_unit - 1;
+    uint64_t int_parts = 0;
+    uint64_t decimal_parts = 0;
+    bool has_decimal = false;
+    uint32_t digit = 0;
+    bool from_integer = false;
+    bool last_decimal = false;
+    int tmp_ret = OB_SUCCESS;
+    ObDigitIterator di;
+    di.assign(nmb.get_desc_value(), nmb.get_digits());
+    while (bret && OB_SUCCESS == (tmp_ret = di.get_next_digit(digit, from_integer, last_decimal))) {
+      if (from_integer) {
+        if (int_parts > (max_int_parts - digit) / ObNumber::BASE) {
+          bret = false;
+        } else {
+          int_parts = int_parts * ObNumber::BASE + digit;
+        }
+      } else if (has_decimal || 0 != digit % decimal_unit) {
+        bret = false;
+      } else {
+        has_decimal = true;
+        decimal_parts = digit / decimal_unit;
+      }
+    }
+    if (bret && OB_ITER_END == tmp_ret) {
+      value = static_cast<int64_t>(int_parts * scale_unit + decimal_parts);
+      value = nmb.is_negative() ? -value : value;
+    } else {
+      bret = false;
+    }
+  }
+  return bret;
+}
+
+int ObAggregateProcessor::scaled_int_to_number(
+    const int64_t value, const int64_t scale, ObIAllocator& allocator, ObNumber& nmb)
+{
+  int ret = OB_SUCCESS;
+  ObNumStackAllocator<2> tmp_alloc;
+  ObNumber value_nmb;
+  ObNumber unit_nmb;
+  if (0 == scale) {
+    if (OB_FAIL(nmb.from(value, allocator))) {
+      LOG_WARN("create number from int failed", K(ret), K(value));
+    }
+  } else if (OB_FAIL(value_nmb.from(value, tmp_alloc))) {
+    LOG_WARN("create number from int failed", K(ret), K(value));
+  } else if (OB_FAIL(unit_nmb.from(POWER_OF_TEN[scale], tmp_alloc))) {
+    LOG_WARN("create number from int failed", K(ret), K(scale));
+  } else if (OB_FAIL(value_nmb.div_v3(unit_nmb, nmb, allocator))) {
+    LOG_WARN("number div failed", K(ret), K(value_nmb), K(unit_nmb));
+  }
+  return ret;
+}
+
 int ObAggregateProcessor::AggrCell::collect_result(
     const ObObjTypeClass tc, ObEvalCtx& eval_ctx, const ObAggrInfo& aggr_info)
 {
@@ -149,15 +224,25 @@ int ObAggregateProcessor::AggrCell::collect_result(
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("count sum should be int", K(ret), K(tc), K(is_tiny_num_used_));
     }
-  } else if (is_tiny_num_used_ && (ObIntTC == tc || ObUIntTC == tc)) {
+  } else if (is_tiny_num_used_ && (ObIntTC == tc || ObUIntTC == tc || ObNumberTC == tc)) {
     ObNumStackAllocator<2> tmp_alloc;
+    char calc_buf[ObNumber::MAX_CALC_BYTE_LEN];
+    ObDataBuffer calc_alloc(calc_buf, ObNumber::MAX_CALC_BYTE_LEN);
     ObNumber result_nmb;
     const bool strict_mode = false;  // this is tmp allocator, so we can ues non-strinct mode
     ObNumber right_nmb;
+    int64_t scale = 0;
     if (ObIntTC == tc) {
       if (OB_FAIL(right_nmb.from(tiny_num_int_, tmp_alloc))) {
         LOG_WARN("create number from int failed", K(ret), K(right_nmb), K(tc));
       }
+    } else if (ObNumberTC == tc) {
+      if (OB_UNLIKELY(!get_scaled_number_scale(aggr_info, scale))) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("tiny num used with invalid scale", K(ret), K(scale));
+      } else if (OB_FAIL(scaled_int_to_number(tiny_num_int_, scale, calc_alloc, right_nmb))) {
+        LOG_WARN("create number from scaled int failed", K(ret), K(tiny_num_int_), K(scale));
+      }
     } else {
       if (OB_FAIL(right_nmb.from(tiny_num_uint_, tmp_alloc))) {
         LOG_WARN("create number from int failed", K(ret), K(right_nmb), K(tc));
@@ -2537,7 +2622,15 @@ int ObAggregateProcessor::prepare_add_calc(const ObDatum& first_value, AggrCell&
       break;
     }
     case ObNumberTC: {
-      ret = clone_cell(result_datum, first_value, true);
+      int64_t scale = 0;
+      int64_t scaled_value = 0;
+      if (get_scaled_number_scale(aggr_info, scale) &&
+          number_to_scaled_int(ObNumber(first_value.get_number()), scale, scaled_value)) {
+        aggr_cell.set_tiny_num_int(scaled_value);
+        aggr_cell.set_tiny_num_used();
+      } else {
+        ret = clone_cell(result_datum, first_value, true);
+      }
       break;
     }
     default: {
@@ -2548,6 +2641,39 @@ int ObAggregateProcessor::prepare_add_calc(const ObDatum& first_value, AggrCell&
   return ret;
 }
 
+// move the scaled number sum in tiny num to iter result
+int ObAggregateProcessor::flush_scaled_number_sum(AggrCell& aggr_cell, const ObAggrInfo& aggr_info)
+{
+  int ret = OB_SUCCESS;
+  ObDatum& result_datum = aggr_cell.get_iter_result();
+  int64_t scale = 0;
+  if (!aggr_cell.is_tiny_num_used() || 0 == aggr_cell.get_tiny_num_int()) {
+    // do nothing
+  } else if (OB_UNLIKELY(!get_scaled_number_scale(aggr_info, scale))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("tiny num used with invalid scale", K(ret), K(scale));
+  } else {
+    char buf_alloc[ObNumber::MAX_CALC_BYTE_LEN * 2];
+    ObDataBuffer allocator(buf_alloc, ObNumber::MAX_CALC_BYTE_LEN * 2);
+    const bool strict_mode = false;  // this is tmp allocator, so we can ues non-strinct mode
+    ObNumber left_nmb;
+    ObNumber result_nmb;
+    if (OB_FAIL(scaled_int_to_number(aggr_cell.get_tiny_num_int(), scale, allocator, left_nmb))) {
+      LOG_WARN("create number from scaled int failed", K(ret), K(scale));
+    } else if (result_datum.is_null()) {
+      ret = clone_number_cell(left_nmb, result_datum);
+    } else if (OB_FAIL(left_nmb.add_v3(ObNumber(result_datum.get_number()), result_nmb, allocator, strict_mode))) {
+      LOG_WARN("number add failed", K(ret), K(left_nmb));
+    } else {
+      ret = clone_number_cell(result_nmb, result_datum);
+    }
+    if (OB_SUCC(ret)) {
+      aggr_cell.set_tiny_num_int(0);
+    }
+  }
+  return ret;
+}
+
 int ObAggregateProcessor::add_calc(const ObDatum& iter_value, AggrCell& aggr_cell, const ObAggrInfo& aggr_info)
 {
   int ret = OB_SUCCESS;
@@ -2638,9 +2764,26 @@ int ObAggregateProcessor::add_calc(const ObDatum& iter_value, AggrCell& aggr_cel
       break;
     }
     case ObNumberTC: {
-      if (result_datum.is_null()) {
+      int64_t scale = 0;
+      int64_t right_int = 0;
+      if (get_scaled_number_scale(aggr_info, scale) &&
+          number_to_scaled_int(ObNumber(iter_value.get_number()), scale, right_int)) {
+        int64_t left_int = aggr_cell.is_tiny_num_used() ? aggr_cell.get_tiny_num_int() : 0;
+        int64_t sum_int = left_int + right_int;
+        if (ObExprAdd::is_int_int_out_of_range(left_int, right_int, sum_int)) {
+          LOG_DEBUG("scaled number add overflow, will use number", K(left_int), K(right_int));
+          if (OB_FAIL(flush_scaled_number_sum(aggr_cell, aggr_info))) {
+            LOG_WARN("flush scaled number sum failed", K(ret));
+          } else {
+            sum_int = right_int;
+          }
+        }
+        if (OB_SUCC(ret)) {
+          aggr_cell.set_tiny_num_int(sum_int);
+          aggr_cell.set_tiny_num_used();
+        }
+      } else if (result_datum.is_null()) {
         ret = clone_cell(result_datum, iter_value, true);
-        ObNumber left_nmb(result_datum.get_number());
       } else {
         char buf_alloc[ObNumber::MAX_CALC_BYTE_LEN];
         ObDataBuffer allocator(buf_alloc, ObNumber::MAX_CALC_BYTE_LEN);
@@ -2761,7 +2904,27 @@ int ObAggregateProcessor::rollup_add_calc(AggrCell& aggr_cell, AggrCell& rollup_
       break;
     }
     case ObNumberTC: {
-      ret = rollup_add_number_calc(aggr_result, rollup_result);
+      // carry the scaled sum to rollup cell, a zero scaled sum is never flushed to iter result
+      if (aggr_cell.is_tiny_num_used()) {
+        int64_t left_int = aggr_cell.get_tiny_num_int();
+        int64_t right_int = rollup_cell.is_tiny_num_used() ? rollup_cell.get_tiny_num_int() : 0;
+        int64_t sum_int = left_int + right_int;
+        if (ObExprAdd::is_int_int_out_of_range(left_int, right_int, sum_int)) {
+          LOG_DEBUG("scaled number add overflow, will use number", K(left_int), K(right_int));
+          if (OB_FAIL(flush_scaled_number_sum(rollup_cell, aggr_info))) {
+            LOG_WARN("flush scaled number sum failed", K(ret));
+          } else {
+            sum_int = left_int;
+          }
+        }
+        if (OB_SUCC(ret)) {
+          rollup_cell.set_tiny_num_int(sum_int);
+          rollup_cell.set_tiny_num_used();
+        }
+      }
+      if (OB_SUCC(ret)) {
+        ret = rollup_add_number_calc(aggr_result, rollup_result);
+      }
       break;
     }
     case ObFloatTC: {
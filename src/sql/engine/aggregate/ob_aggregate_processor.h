@@ -120,6 +120,8 @@ inline bool ObAggrInfo::is_number() const
 typedef common::ObFixedArray<ObDatum, common::ObIAllocator> DatumFixedArray;
 
 class ObAggregateProcessor {
+  friend class TestScaledNumberSum;
+
 public:
   // Context structure for one aggregation function of one group, only some functions need this:
   //  with distinct: need this for distinct calculate
@@ -332,7 +334,7 @@ public:
     // for avg/count
     int64_t row_count_;
 
-    // for int fast path
+    // for int and small scale number fast path
     union {
       int64_t tiny_num_int_;
       uint64_t tiny_num_uint_;
@@ -452,6 +454,11 @@ private:
   int min_calc(ObDatum& base, const ObDatum& other, common::ObDatumCmpFuncType cmp_func, const bool is_number);
   int prepare_add_calc(const ObDatum& iter_value, AggrCell& aggr_cell, const ObAggrInfo& aggr_info);
   int add_calc(const ObDatum& iter_value, AggrCell& aggr_cell, const ObAggrInfo& aggr_info);
+  int flush_scaled_number_sum(AggrCell& aggr_cell, const ObAggrInfo& aggr_info);
+  static bool get_scaled_number_scale(const ObAggrInfo& aggr_info, int64_t& scale);
+  static bool number_to_scaled_int(const number::ObNumber& nmb, const int64_t scale, int64_t& value);
+  static int scaled_int_to_number(
+      const int64_t value, const int64_t scale, common::ObIAllocator& allocator, number::ObNumber& nmb);
   int rollup_add_calc(AggrCell& aggr_cell, AggrCell& rollup_cell, const ObAggrInfo& aggr_info);
   int search_op_expr(ObExpr* upper_expr, const ObItemType dst_op, ObExpr*& res_expr);
   int linear_inter_calc(const ObAggrInfo& aggr_info, const ObDatum& prev_datum, const ObDatum& curr_datum,
@@ -2850,25 +2850,49 @@ int ObLoadDataSPImpl::exec_shuffle(int64_t task_id, ObShuffleTaskHandle* handle)
   return ret;
 }
 
+// escape the field into the end of %sql_str directly, most fields need no escape and are copied as is
+static int append_escaped_field(ObSqlString& sql_str, const ObString& field)
+{
+  int ret = OB_SUCCESS;
+  ObHexEscapeSqlStr escape_str(field);
+  const int64_t escaped_len = field.length() + escape_str.get_extra_length();
+  if (escaped_len == field.length()) {
+    if (OB_FAIL(sql_str.append(field))) {
+      LOG_WARN("fail to append field", K(ret));
+    }
+  } else if (OB_FAIL(sql_str.reserve(sql_str.length() + escaped_len))) {
+    LOG_WARN("fail to reserve sql string", K(ret), K(escaped_len));
+  } else {
+    const int64_t pos = sql_str.length();
+    const int64_t write_len = escape_str.to_string(sql_str.ptr() + pos, sql_str.capacity() - pos);
+    if (OB_UNLIKELY(write_len != escaped_len)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("escaped length is not as expected", K(ret), K(write_len), K(escaped_len));
+    } else if (OB_FAIL(sql_str.set_length(pos + write_len))) {
+      LOG_WARN("fail to set length", K(ret), K(pos), K(write_len));
+    }
+  }
+  return ret;
+}
+
 int ObLoadDataSPImpl::exec_insert(ObInsertTask& task, ObInsertResult& result)
 {
   UNUSED(result);
   int ret = OB_SUCCESS;
   int64_t sql_buff_len_init = OB_MALLOC_BIG_BLOCK_SIZE;  // 2M
-  int64_t field_buf_len = OB_MAX_VARCHAR_LENGTH;
-  char* field_buff = NULL;
   ObSqlString sql_str(ObModIds::OB_SQL_LOAD_DATA);
   ObSEArray<ObString, 1> single_row_values;
-  ObMemAttr attr(task.tenant_id_, ObModIds::OB_SQL_LOAD_DATA);
 
 #ifdef TEST_MODE
   delay_process_by_probability(INSERT_TASK_DROP_RATE);
 #endif
 
-  if (OB_ISNULL(field_buff = static_cast<char*>(ob_malloc(field_buf_len, attr)))) {
-    ret = OB_ALLOCATE_MEMORY_FAILED;
-    LOG_WARN("fail to ob malloc", K(ret), K(field_buf_len));
+  // values text is about the size of serialized values, plus quotes and commas of each field
+  int64_t sql_len_estimate = task.insert_stmt_head_.length() + task.row_count_ * (task.column_count_ * 3 + 3);
+  for (int64_t buf_i = 0; buf_i < task.insert_value_data_.count(); ++buf_i) {
+    sql_len_estimate += task.insert_value_data_[buf_i].length();
   }
+  sql_buff_len_init = std::max(sql_buff_len_init, sql_len_estimate);
   OZ(single_row_values.reserve(task.column_count_));
   OZ(sql_str.extend(sql_buff_len_init));
   OZ(sql_str.append(task.insert_stmt_head_));
@@ -2910,8 +2934,7 @@ int ObLoadDataSPImpl::exec_insert(ObInsertTask& task, ObInsertResult& result)
           if (is_string_column) {
             OZ(sql_str.append("'", 1));
           }
-          int64_t field_data_pos = ObHexEscapeSqlStr(single_row_values[c]).to_string(field_buff, field_buf_len);
-          OZ(sql_str.append(ObString(field_data_pos, field_buff)));
+          OZ(append_escaped_field(sql_str, single_row_values[c]));
           if (is_string_column) {
             OZ(sql_str.append("'", 1));
           }
@@ -2950,10 +2973,6 @@ int ObLoadDataSPImpl::exec_insert(ObInsertTask& task, ObInsertResult& result)
   delay_process_by_probability(INSERT_TASK_DROP_RATE);
 #endif
 
-  if (OB_NOT_NULL(field_buff)) {
-    ob_free(field_buff);
-  }
-
   return ret;
 }
 
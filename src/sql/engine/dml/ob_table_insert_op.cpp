@@ -76,33 +76,27 @@ OB_INLINE int ObTableInsertOp::insert_rows(
       }
     }
   } else {
-    // multi part insert
+    // multi part insert, rows are grouped by partition already when shuffled by the multi part
+    // insert operator. Insert each group in bulk, the row iterator stops at its end.
     for (int64_t i = 0; OB_SUCC(ret) && i < part_infos.count(); ++i) {
       const ObPartitionKey& pkey = part_infos.at(i).partition_key_;
+      int64_t part_affected_rows = 0;
       part_row_cnt_ = part_infos.at(i).part_row_cnt_;
-      ObNewRow* row = NULL;
-      int64_t affected_row = 0;
-      while (OB_SUCC(ret) && OB_SUCC(dml_row_iter.get_next_row(row))) {
-        if (OB_FAIL(partition_service->insert_row(
-                my_session->get_trans_desc(), dml_param, pkey, MY_SPEC.column_ids_, *row))) {
-          if (OB_ERR_PRIMARY_KEY_DUPLICATE == ret) {
-            LOG_WARN("pk conflict", K(ret));
-          } else if (OB_TRY_LOCK_ROW_CONFLICT != ret) {
-            LOG_WARN("insert row to partition storage failed", K(ret));
-          }
-        } else {
-          affected_rows += affected_row;
-          if (part_row_cnt_ <= 0) {
-            break;
-          }
+      if (OB_FAIL(partition_service->insert_rows(my_session->get_trans_desc(),
+              dml_param,
+              pkey,
+              MY_SPEC.column_ids_,
+              &dml_row_iter,
+              part_affected_rows))) {
+        if (OB_ERR_PRIMARY_KEY_DUPLICATE == ret) {
+          LOG_WARN("pk conflict", K(ret), K(pkey));
+        } else if (OB_TRY_LOCK_ROW_CONFLICT != ret) {
+          LOG_WARN("insert rows to partition storage failed", K(ret), K(pkey));
         }
+      } else {
+        affected_rows += part_affected_rows;
       }
     }
-    if (OB_ITER_END == ret) {
-      ret = OB_SUCCESS;
-    } else if (OB_FAIL(ret)) {
-      LOG_WARN("process insert row failed", K(ret));
-    }
   }
 
   return ret;
@@ -300,13 +294,28 @@ int ObSeInsertRowIterator::setup_row_copy_mem()
   return ret;
 }
 
+int ObSeInsertRowIterator::get_next_row(common::ObNewRow*& row)
+{
+  int ret = OB_SUCCESS;
+  ObTableInsertOp& insert_op = static_cast<ObTableInsertOp&>(op_);
+  if (insert_op.get_spec().from_multi_table_dml() && insert_op.part_infos_.count() > 1 &&
+      insert_op.part_row_cnt_ <= 0) {
+    // rows of current partition are used up, see ObTableInsertOp::insert_rows()
+    ret = OB_ITER_END;
+  } else {
+    ret = DMLRowIterator::get_next_row(row);
+  }
+  return ret;
+}
+
 int ObSeInsertRowIterator::get_next_rows(common::ObNewRow*& rows, int64_t& row_count)
 {
   int ret = OB_SUCCESS;
   ObPhysicalPlanCtx* plan_ctx = GET_PHY_PLAN_CTX(ctx_);
   row_count = 0;
   ObTableInsertOp& insert_op = static_cast<ObTableInsertOp&>(op_);
-  if ((1 == insert_op.get_child()->get_spec().rows_ && plan_ctx->get_bind_array_count() <= 0)) {
+  if (!insert_op.get_spec().from_multi_table_dml() && 1 == insert_op.get_child()->get_spec().rows_ &&
+      plan_ctx->get_bind_array_count() <= 0) {
     ret = get_next_row(rows);
     row_count = (OB_SUCCESS == ret) ? 1 : 0;
   } else if (OB_FAIL(setup_row_copy_mem())) {
@@ -315,7 +324,13 @@ int ObSeInsertRowIterator::get_next_rows(common::ObNewRow*& rows, int64_t& row_c
     ObOperator* child_op = insert_op.get_child();
     if (first_bulk_) {
       first_bulk_ = false;
-      if (PHY_EXPR_VALUES != child_op->get_spec().type_) {
+      if (insert_op.get_spec().from_multi_table_dml()) {
+        // row count of each partition is known, get rows in bulk up to the largest one
+        estimate_rows_ = 1;
+        for (int64_t i = 0; i < insert_op.part_infos_.count(); ++i) {
+          estimate_rows_ = std::max(estimate_rows_, insert_op.part_infos_.at(i).part_row_cnt_);
+        }
+      } else if (PHY_EXPR_VALUES != child_op->get_spec().type_) {
         estimate_rows_ = 1;
       } else {
         estimate_rows_ = child_op->get_spec().rows_;
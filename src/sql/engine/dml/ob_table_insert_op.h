@@ -98,6 +98,7 @@ public:
     destroy_row_copy_mem();
   }
 
+  int get_next_row(common::ObNewRow*& row) override;
   int get_next_rows(common::ObNewRow*& row, int64_t& row_count) override;
   virtual void reset() override;
 
@@ -43,28 +43,29 @@ int ObExprFrameInfo::pre_alloc_exec_memory(ObExecContext& exec_ctx) const
   return ret;
 }
 
-#define ALLOC_FRAME_MEM(frame_info_arr)                                                           \
-  for (int64_t i = 0; OB_SUCC(ret) && i < frame_info_arr.count(); i++) {                          \
-    char* frame_mem = static_cast<char*>(exec_allocator.alloc(frame_info_arr.at(i).frame_size_)); \
-    if (OB_ISNULL(frame_mem)) {                                                                   \
-      ret = OB_ALLOCATE_MEMORY_FAILED;                                                            \
-      LOG_WARN("alloc memory failed", K(ret), K(frame_info_arr.at(i).frame_size_));               \
-    } else {                                                                                      \
-      memset(frame_mem, 0, frame_info_arr.at(i).frame_size_);                                     \
-      frames[frame_idx++] = frame_mem;                                                            \
-    }                                                                                             \
-  }
-
 int ObExprFrameInfo::alloc_frame(
     common::ObIAllocator& exec_allocator, ObPhysicalPlanCtx& phy_ctx, uint64_t& frame_cnt, char**& frames) const
 {
   int ret = common::OB_SUCCESS;
   frame_cnt = const_frame_ptrs_.count() + param_frame_.count() + dynamic_frame_.count() + datum_frame_.count();
+  // dynamic and datum frames are carved from one piece of memory, it is allocated for every execution
+  // of the plan, one allocation instead of one per frame matters for short queries.
+  int64_t frames_mem_size = 0;
+  for (int64_t i = 0; i < dynamic_frame_.count(); i++) {
+    frames_mem_size += upper_align(dynamic_frame_.at(i).frame_size_, FRAME_ALIGN_SIZE);
+  }
+  for (int64_t i = 0; i < datum_frame_.count(); i++) {
+    frames_mem_size += upper_align(datum_frame_.at(i).frame_size_, FRAME_ALIGN_SIZE);
+  }
+  char* frames_mem = NULL;
   if (frame_cnt == 0) {
     // do nothing
   } else if (NULL == (frames = static_cast<char**>(exec_allocator.alloc(frame_cnt * sizeof(char*))))) {
     ret = OB_ALLOCATE_MEMORY_FAILED;
     LOG_WARN("alloc memory failed", K(ret), K(frame_cnt));
+  } else if (frames_mem_size > 0 && NULL == (frames_mem = static_cast<char*>(exec_allocator.alloc(frames_mem_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("alloc memory failed", K(ret), K(frames_mem_size));
   } else {
     int64_t frame_idx = 0;  // frame idx
     OB_ASSERT(const_frame_ptrs_.count() == const_frame_.count());
@@ -75,22 +76,27 @@ int ObExprFrameInfo::alloc_frame(
     for (int64_t i = 0; i < phy_ctx.get_param_frame_ptrs().count(); i++) {
       frames[frame_idx++] = phy_ctx.get_param_frame_ptrs().at(i);
     }
-    int64_t begin_idx = frame_idx;
+    if (frames_mem_size > 0) {
+      memset(frames_mem, 0, frames_mem_size);
+    }
     const int64_t datum_eval_info_size = sizeof(ObDatum) + sizeof(ObEvalInfo);
-    ALLOC_FRAME_MEM(dynamic_frame_);
-    for (int64_t i = 0; OB_SUCC(ret) && i < dynamic_frame_.count(); ++i) {
-      char* cur_frame = frames[begin_idx + i];
+    for (int64_t i = 0; i < dynamic_frame_.count(); i++) {
+      char* cur_frame = frames_mem;
       for (int64_t j = 0; j < dynamic_frame_.at(i).expr_cnt_; ++j) {
         ObDatum* datum = reinterpret_cast<ObDatum*>(cur_frame + j * datum_eval_info_size);
         datum->set_null();
       }
+      frames[frame_idx++] = cur_frame;
+      frames_mem += upper_align(dynamic_frame_.at(i).frame_size_, FRAME_ALIGN_SIZE);
+    }
+    for (int64_t i = 0; i < datum_frame_.count(); i++) {
+      frames[frame_idx++] = frames_mem;
+      frames_mem += upper_align(datum_frame_.at(i).frame_size_, FRAME_ALIGN_SIZE);
     }
-    ALLOC_FRAME_MEM(datum_frame_);
   }
 
   return ret;
 }
-#undef ALLOC_FRAME_MEM
 
 int ObPreCalcExprFrameInfo::assign(const ObPreCalcExprFrameInfo& other, common::ObIAllocator& allocator)
 {
@@ -42,6 +42,8 @@ public:
 
 struct ObExprFrameInfo {
   static const int64_t EXPR_CNT_PER_FRAME = common::MAX_FRAME_SIZE / (sizeof(ObDatum) + sizeof(ObEvalInfo));
+  // frames allocated together start at this alignment
+  static const int64_t FRAME_ALIGN_SIZE = 16;
   ObExprFrameInfo(common::ObIAllocator& allocator)
       : need_ctx_cnt_(0),
         rt_exprs_(0, common::ModulePageAllocator(allocator)),
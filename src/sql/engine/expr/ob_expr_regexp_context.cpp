@@ -49,7 +49,8 @@ void* ObInplaceAllocator::alloc(const int64_t size)
   return mem;
 }
 
-ObExprRegexContext::ObExprRegexContext() : ObExprOperatorCtx(), inited_(false), reg_()
+ObExprRegexContext::ObExprRegexContext()
+    : ObExprOperatorCtx(), inited_(false), reg_(), literal_len_(0), literal_icase_(false)
 {}
 
 ObExprRegexContext::~ObExprRegexContext()
@@ -117,6 +118,7 @@ int ObExprRegexContext::init(const ObString& pattern, int cflags, ObExprStringBu
         LOG_WARN("regex compilation failed", K(ret));
         destroy();
       } else {
+        extract_required_literal(pattern, cflags);
         inited_ = true;
       }
     }
@@ -124,6 +126,142 @@ int ObExprRegexContext::init(const ObString& pattern, int cflags, ObExprStringBu
   return ret;
 }
 
+static inline char ascii_tolower(const char c)
+{
+  return ('A' <= c && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
+}
+
+static inline bool is_plain_regex_char(const char c)
+{
+  return ' ' <= c && c <= '~' && NULL == strchr("^$.[]()|*+?{}\\", c);
+}
+
+// Find the longest run of plain chars outside any group, alternation disables it because
+// no char is required then. The char before a quantifier which allows zero repeat is optional,
+// it ends the run and is not part of it.
+void ObExprRegexContext::extract_required_literal(const ObString& pattern, int cflags)
+{
+  const char* p = pattern.ptr();
+  const int64_t len = pattern.length();
+  int64_t best_start = 0;
+  int64_t best_len = 0;
+  literal_len_ = 0;
+  literal_icase_ = false;
+  if (0 != (cflags & (OB_REG_EXPANDED | OB_REG_QUOTE)) || NULL == p || NULL != memchr(p, '|', len) ||
+      (len >= 3 && 0 == MEMCMP(p, "***", 3)) || (len >= 2 && '(' == p[0] && '?' == p[1])) {
+    // directors and embedded options change the syntax, leave them to the regex library
+  } else {
+    int64_t depth = 0;
+    int64_t run_start = 0;
+    int64_t run_len = 0;
+    int64_t i = 0;
+    while (i < len) {
+      const char c = p[i];
+      if (0 == depth && is_plain_regex_char(c)) {
+        if (0 == run_len) {
+          run_start = i;
+        }
+        ++run_len;
+        ++i;
+      } else {
+        if (run_len > 0 && ('?' == c || '*' == c || '{' == c)) {
+          --run_len;
+        }
+        if (run_len > best_len) {
+          best_start = run_start;
+          best_len = run_len;
+        }
+        run_len = 0;
+        if ('\\' == c) {
+          // skip the whole escape, including the digits of \x41, \u0041 and \0101
+          i += 2;
+          while (i < len && isalnum(static_cast<unsigned char>(p[i]))) {
+            ++i;
+          }
+        } else if ('[' == c) {
+          i += 1;
+          i += (i < len && '^' == p[i]) ? 1 : 0;
+          i += (i < len && ']' == p[i]) ? 1 : 0;
+          while (i < len && ']' != p[i]) {
+            if ('\\' == p[i]) {
+              i += 2;
+            } else if ('[' == p[i] && i + 1 < len && (':' == p[i + 1] || '.' == p[i + 1] || '=' == p[i + 1])) {
+              const char delim = p[i + 1];
+              i += 2;
+              while (i + 1 < len && !(delim == p[i] && ']' == p[i + 1])) {
+                ++i;
+              }
+              i += 2;
+            } else {
+              ++i;
+            }
+          }
+          ++i;
+        } else if ('{' == c) {
+          // skip the bound
+          while (i < len && '}' != p[i]) {
+            ++i;
+          }
+          ++i;
+        } else {
+          depth += ('(' == c) ? 1 : 0;
+          depth -= (')' == c && depth > 0) ? 1 : 0;
+          ++i;
+        }
+      }
+    }
+    if (run_len > best_len) {
+      best_start = run_start;
+      best_len = run_len;
+    }
+  }
+  if (best_len > 0) {
+    literal_len_ = min(best_len, static_cast<int64_t>(MAX_LITERAL_LEN));
+    for (int64_t i = 0; i < literal_len_; ++i) {
+      const char c = p[best_start + i];
+      if (0 != (cflags & OB_REG_ICASE) && isalpha(static_cast<unsigned char>(c))) {
+        literal_icase_ = true;
+      }
+      literal_[i] = ascii_tolower(c);
+    }
+    if (!literal_icase_) {
+      MEMCPY(literal_, p + best_start, literal_len_);
+    }
+  }
+}
+
+bool ObExprRegexContext::may_match(const ObString& text) const
+{
+  bool bret = true;
+  const char* s = text.ptr();
+  const int64_t len = text.length();
+  if (0 == literal_len_) {
+  } else if (len < literal_len_) {
+    bret = false;
+  } else if (!literal_icase_) {
+    bret = (NULL != memmem(s, len, literal_, literal_len_));
+  } else {
+    // non ascii chars may be case folded to ascii letters (e.g. KELVIN SIGN), check ascii text only
+    bool is_ascii = true;
+    for (int64_t i = 0; is_ascii && i < len; ++i) {
+      is_ascii = (0 == (s[i] & 0x80));
+    }
+    if (is_ascii) {
+      bret = false;
+      for (int64_t i = 0; !bret && i + literal_len_ <= len; ++i) {
+        if (ascii_tolower(s[i]) == literal_[0]) {
+          int64_t j = 1;
+          while (j < literal_len_ && ascii_tolower(s[i + j]) == literal_[j]) {
+            ++j;
+          }
+          bret = (j == literal_len_);
+        }
+      }
+    }
+  }
+  return bret;
+}
+
 int ObExprRegexContext::match(
     const ObString& text, int64_t start_offset, bool& is_match, ObExprStringBuf& string_buf) const
 {
@@ -136,6 +274,8 @@ int ObExprRegexContext::match(
   } else if (text.length() < 0 || (text.length() > 0 && OB_ISNULL(text.ptr()))) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("invalid param", K(ret), K(text));
+  } else if (!may_match(text)) {
+    is_match = false;
   } else {
     const static int64_t NMATCH = 1;
     ob_regmatch_t pmatch[NMATCH];
@@ -376,6 +516,8 @@ int ObExprRegexContext::like(const ObString& text, int64_t occurrence, bool& sub
   } else if (text.length() < 0 || (text.length() > 0 && OB_ISNULL(text.ptr()))) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("invalid param, source text is null", K(ret), K(text));
+  } else if (!may_match(text)) {
+    sub = false;
   } else {
     size_t nsub = reg_.re_nsub;
     ob_regmatch_t pmatch[nsub + 1];
@@ -804,6 +946,8 @@ void ObExprRegexContext::destroy()
     reset_reg();
     inited_ = false;
   }
+  literal_len_ = 0;
+  literal_icase_ = false;
 }
 
 int ObExprRegexContext::pre_process_replace_str(const ObString& text, const ObString& to, ObExprStringBuf& string_buf,
@@ -58,6 +58,9 @@ private:
 };
 
 class ObExprRegexContext : public ObExprOperatorCtx {
+  // Longest literal every match must contain, used to reject text before converting it to wide chars.
+  static const int64_t MAX_LITERAL_LEN = 64;
+
 public:
   ObExprRegexContext();
   virtual ~ObExprRegexContext();
@@ -98,10 +101,13 @@ public:
   int extract_subpre_string(const wchar_t* wc_text, int64_t wc_length, int64_t start_pos, ob_regmatch_t pmatch[],
       uint64_t pmatch_size, common::ObExprStringBuf& string_buf,
       common::ObIArray<common::ObString>& subexpr_array) const;
-  TO_STRING_KV(K_(inited));
+  TO_STRING_KV(K_(inited), K_(literal_len), K_(literal_icase));
 
 private:
   void reset_reg();
+  void extract_required_literal(const common::ObString& pattern, int cflags);
+  // false if %text can not match the pattern for sure
+  bool may_match(const common::ObString& text) const;
   int getwc(const common::ObString& text, wchar_t*& wc, int64_t& wc_length, common::ObExprStringBuf& string_buf) const;
   int w2c(
       const wchar_t* wc, int64_t length, char*& chr, int64_t& chr_length, common::ObExprStringBuf& string_buf) const;
@@ -115,6 +121,10 @@ private:
   common::ObString pattern_;
 
   ObInplaceAllocator pattern_wc_allocator_;
+
+  char literal_[MAX_LITERAL_LEN];
+  int64_t literal_len_;
+  bool literal_icase_;
 };
 }  // namespace sql
 }  // namespace oceanbase
@@ -179,11 +179,11 @@ int ObExprRegexpLike::regexp_like(bool& match, const ObString& text, const ObStr
   if (OB_ISNULL(regexp_like_ctx)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("regexp ptr is null", K(ret));
+  } else if (OB_FAIL(ObExprRegexpCount::get_regexp_flags(calc_cs_type, match_param, flags, multi_flag))) {
+    LOG_WARN("fail to get regexp flags", K(ret), K(match_param));
   } else if (!regexp_like_ctx->is_inited()) {
     const bool reusable = false;
-    if (OB_FAIL(ObExprRegexpCount::get_regexp_flags(calc_cs_type, match_param, flags, multi_flag))) {
-      LOG_WARN("fail to get regexp flags", K(ret), K(match_param));
-    } else if (OB_FAIL(regexp_like_ctx->init(pattern, flags, string_buf, reusable))) {
+    if (OB_FAIL(regexp_like_ctx->init(pattern, flags, string_buf, reusable))) {
       LOG_WARN("fail to init regexp", K(pattern), K(flags));
     }
   }
@@ -262,11 +262,20 @@ int ObExprRegexpLike::calc(common::ObObj& result, const ObString& text, const Ob
   return ret;
 }
 
-int ObExprRegexpLike::cg_expr(ObExprCGCtx&, const ObRawExpr&, ObExpr& rt_expr) const
+int ObExprRegexpLike::cg_expr(ObExprCGCtx&, const ObRawExpr& raw_expr, ObExpr& rt_expr) const
 {
   int ret = OB_SUCCESS;
   CK(2 == rt_expr.arg_cnt_ || 3 == rt_expr.arg_cnt_);
-  rt_expr.eval_func_ = &eval_regexp_like;
+  if (OB_SUCC(ret)) {
+    // the compiled pattern is kept in expr ctx and shared by all rows if pattern and flags are const.
+    bool const_pattern = true;
+    for (int64_t i = 1; const_pattern && i < raw_expr.get_param_count(); ++i) {
+      const ObRawExpr* param = raw_expr.get_param_expr(i);
+      const_pattern = (NULL != param && (param->has_flag(IS_CONST) || param->has_flag(IS_CONST_EXPR)));
+    }
+    rt_expr.extra_ = const_pattern ? 1 : 0;
+    rt_expr.eval_func_ = &eval_regexp_like;
+  }
   return ret;
 }
 
@@ -285,13 +294,37 @@ int ObExprRegexpLike::eval_regexp_like(const ObExpr& expr, ObEvalCtx& ctx, ObDat
     ObString match_param = (NULL != flags && !flags->is_null()) ? flags->get_string() : ObString();
     const int64_t pos = 1;
     const int64_t occurrence = 1;
-    ObExprRegexContext regexp_ctx;
+    const bool reusable = (0 != expr.extra_) && ObExpr::INVALID_EXP_CTX_ID != expr.expr_ctx_id_;
+    ObExprRegexContext local_regexp_ctx;
+    ObExprRegexContext* regexp_ctx = &local_regexp_ctx;
     ObIAllocator& alloc = ctx.get_reset_tmp_alloc();
     bool match = false;
     if (share::is_mysql_mode() && !pattern->is_null() && pattern->get_string().empty() &&
         !is_flag_null) {  // compatible mysql
       ret = OB_ERR_REGEXP_ERROR;
       LOG_WARN("empty regex expression", K(ret));
+    } else if (reusable) {
+      if (NULL == (regexp_ctx = static_cast<ObExprRegexContext*>(ctx.exec_ctx_.get_expr_op_ctx(expr.expr_ctx_id_)))) {
+        if (OB_FAIL(ctx.exec_ctx_.create_expr_op_ctx(expr.expr_ctx_id_, regexp_ctx))) {
+          LOG_WARN("create expr regex context failed", K(ret), K(expr));
+        } else if (OB_ISNULL(regexp_ctx)) {
+          ret = OB_ERR_UNEXPECTED;
+          LOG_WARN("NULL context returned", K(ret));
+        } else {
+          // compile with the allocator of exec ctx, which lives as long as the context.
+          int cflags = 0;
+          int multi_flag = 0;
+          if (OB_FAIL(ObExprRegexpCount::get_regexp_flags(
+                  expr.args_[0]->datum_meta_.cs_type_, match_param, cflags, multi_flag))) {
+            LOG_WARN("fail to get regexp flags", K(ret), K(match_param));
+          } else if (OB_FAIL(regexp_ctx->init(
+                         pattern->get_string(), cflags, ctx.exec_ctx_.get_allocator(), false /*reusable*/))) {
+            LOG_WARN("fail to init regexp", K(ret), K(pattern->get_string()), K(cflags));
+          }
+        }
+      }
+    }
+    if (OB_FAIL(ret)) {
     } else if (OB_FAIL(regexp_like(match,
                    text->get_string(),
                    pattern->get_string(),
@@ -300,7 +333,7 @@ int ObExprRegexpLike::eval_regexp_like(const ObExpr& expr, ObEvalCtx& ctx, ObDat
                    expr.args_[0]->datum_meta_.cs_type_,
                    match_param,
                    null_result,
-                   &regexp_ctx,
+                   regexp_ctx,
                    alloc))) {
       LOG_WARN("do regexp like failed", K(ret));
     } else if (null_result) {
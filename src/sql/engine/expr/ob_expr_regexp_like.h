@@ -27,6 +27,10 @@ public:
   virtual int calc_resultN(
       common::ObObj& result, const common::ObObj* objs, int64_t param_num, common::ObExprCtx& expr_ctx) const override;
 
+  virtual bool need_rt_ctx() const override
+  {
+    return true;
+  }
   virtual int cg_expr(ObExprCGCtx& op_cg_ctx, const ObRawExpr& raw_expr, ObExpr& rt_expr) const override;
 
   static int eval_regexp_like(const ObExpr& expr, ObEvalCtx& ctx, ObDatum& expr_datum);
@@ -24,6 +24,7 @@
 #include "sql/optimizer/ob_optimizer_util.h"
 #include "share/stat/ob_stat_manager.h"
 #include "share/stat/ob_opt_column_stat_cache.h"
+#include "share/stat/ob_opt_stat_manager.h"
 #include "share/stat/ob_column_stat_cache.h"
 #include "share/stat/ob_table_stat.h"
 #include "sql/optimizer/ob_logical_operator.h"
@@ -956,6 +957,127 @@ int ObOptEstSel::get_var_basic_from_statics(const ObEstSelInfo& est_sel_info, co
   return ret;
 }
 
+int ObOptEstSel::get_column_histogram(const ObEstSelInfo& est_sel_info, const ObColumnRefRawExpr& col_var,
+    ObOptColumnStatHandle& handle, const ObHistogram*& histogram)
+{
+  int ret = OB_SUCCESS;
+  const ObDMLStmt* stmt = NULL;
+  const TableItem* table_item = NULL;
+  ObOptStatManager* opt_stat_manager = NULL;
+  int64_t part_id = OB_INVALID_INDEX_INT64;
+  histogram = NULL;
+  if (OB_ISNULL(stmt = est_sel_info.get_stmt())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Invalid argument of NULL pointer", K(stmt), K(ret));
+  } else if (est_sel_info.use_default_stat() ||
+             OB_ISNULL(opt_stat_manager = const_cast<ObOptStatManager*>(est_sel_info.get_opt_stat_manager()))) {
+    // no statistics
+  } else if (OB_ISNULL(table_item = get_table_item_for_statics(*stmt, col_var.get_table_id())) ||
+             !table_item->is_basic_table()) {
+    // no statistics
+  } else if (OB_FAIL(est_sel_info.get_table_stats().get_part_id_by_table_id(col_var.get_table_id(), part_id))) {
+    LOG_WARN("Failed to get part id from est_sel_info", K(ret));
+  } else if (OB_INVALID_INDEX_INT64 == part_id) {
+    // statistics partition is unknown
+  } else {
+    int tmp_ret = OB_SUCCESS;
+    ObOptColumnStat::Key key(table_item->ref_id_, part_id, col_var.get_column_id());
+    // histogram is optional, never block plan generation on loading it. on a cache miss fall back to
+    // basic statistics and let the stat manager load it in the background.
+    if (OB_SUCCESS != (tmp_ret = opt_stat_manager->get_column_stat_from_cache(key, handle))) {
+      LOG_TRACE("failed to get opt column stat from cache", K(tmp_ret), K(key));
+      if (OB_ENTRY_NOT_EXIST == tmp_ret) {
+        obrpc::ObUpdateStatCacheArg refresh_arg;
+        refresh_arg.tenant_id_ = extract_tenant_id(key.table_id_);
+        refresh_arg.table_id_ = key.table_id_;
+        if (OB_SUCCESS != (tmp_ret = refresh_arg.partition_ids_.push_back(key.partition_id_))) {
+          LOG_WARN("failed to push back partition id", K(tmp_ret));
+        } else if (OB_SUCCESS != (tmp_ret = refresh_arg.column_ids_.push_back(key.column_id_))) {
+          LOG_WARN("failed to push back column id", K(tmp_ret));
+        } else if (OB_SUCCESS != (tmp_ret = opt_stat_manager->add_refresh_stat_task(refresh_arg))) {
+          LOG_TRACE("failed to add refresh stat task", K(tmp_ret), K(key));
+        }
+      }
+    } else if (NULL != handle.stat_ && handle.stat_->has_histogram()) {
+      histogram = handle.stat_->get_histogram();
+    }
+  }
+  return ret;
+}
+
+int ObOptEstSel::get_histogram_equal_sel(const ObEstSelInfo& est_sel_info, const ObColumnRefRawExpr& col_var,
+    const ObRawExpr& calculable_expr, bool& sel_got, double& selectivity)
+{
+  int ret = OB_SUCCESS;
+  ObOptColumnStatHandle handle;
+  const ObHistogram* histogram = NULL;
+  ObObj value;
+  bool get_value = false;
+  double null_sel = 0;
+  double density = 0;
+  sel_got = false;
+  if (OB_FAIL(get_column_histogram(est_sel_info, col_var, handle, histogram))) {
+    LOG_WARN("Failed to get column histogram", K(ret));
+  } else if (NULL == histogram) {
+    // do nothing
+  } else if (OB_FAIL(ObOptEstUtils::get_expr_value(est_sel_info.get_params(),
+                 calculable_expr,
+                 const_cast<ObSQLSessionInfo*>(est_sel_info.get_session_info()),
+                 const_cast<ObIAllocator&>(est_sel_info.get_allocator()),
+                 get_value,
+                 value))) {
+    LOG_WARN("Failed to get expr value", K(ret));
+  } else if (!get_value || value.is_null()) {
+    // do nothing
+  } else if (OB_FAIL(histogram->get_equal_density(
+                 value, ObBasicSessionInfo::create_dtc_params(est_sel_info.get_session_info()), density))) {
+    LOG_WARN("Failed to get equal density", K(ret), K(value));
+  } else if (OB_FAIL(get_var_basic_sel(est_sel_info, col_var, NULL, &null_sel))) {
+    LOG_WARN("Failed to get var basic sel", K(ret));
+  } else {
+    // density counts non-null rows only
+    selectivity = revise_between_0_1(density * (1 - null_sel));
+    sel_got = true;
+    LOG_TRACE("histogram equal sel", K(value), K(density), K(null_sel), K(selectivity));
+  }
+  return ret;
+}
+
+int ObOptEstSel::get_histogram_range_sel(const ObEstSelInfo& est_sel_info, const ObColumnRefRawExpr& col_var,
+    const ObObj& startobj, const ObObj& endobj, const ObBorderFlag border_flag, const double null_sel, bool& sel_got,
+    bool& last_column, double& selectivity)
+{
+  int ret = OB_SUCCESS;
+  ObOptColumnStatHandle handle;
+  const ObHistogram* histogram = NULL;
+  double density = 0;
+  const ObDataTypeCastParams dtc_params = ObBasicSessionInfo::create_dtc_params(est_sel_info.get_session_info());
+  const bool is_single_value =
+      border_flag.inclusive_start() && border_flag.inclusive_end() && startobj.is_equal(endobj, CS_TYPE_BINARY);
+  sel_got = false;
+  if (OB_FAIL(get_column_histogram(est_sel_info, col_var, handle, histogram))) {
+    LOG_WARN("Failed to get column histogram", K(ret));
+  } else if (NULL == histogram) {
+    // do nothing
+  } else if (is_single_value) {
+    if (OB_FAIL(histogram->get_equal_density(startobj, dtc_params, density))) {
+      LOG_WARN("Failed to get equal density", K(ret), K(startobj));
+    } else {
+      last_column = false;
+      sel_got = true;
+    }
+  } else if (OB_FAIL(histogram->get_density_between_range(startobj, endobj, border_flag, dtc_params, density))) {
+    LOG_WARN("Failed to get density between range", K(ret), K(startobj), K(endobj));
+  } else {
+    last_column = true;
+    sel_got = true;
+  }
+  if (OB_SUCC(ret) && sel_got) {
+    selectivity = revise_between_0_1(density * (1 - null_sel));
+  }
+  return ret;
+}
+
 int ObOptEstSel::get_var_basic_default(
     double& distinct_num, double& null_num, double& row_count, double& origin_row_count)
 {
@@ -1065,6 +1187,11 @@ int ObOptEstSel::get_simple_predicate_sel(const ObEstSelInfo& est_sel_info, cons
     } else {
       get_distinct_sel = true;
     }
+    if (OB_SUCC(ret) && !sel_got && get_distinct_sel && NULL != calculable_expr && col_expr == &cnt_col_expr) {
+      if (OB_FAIL(get_histogram_equal_sel(est_sel_info, *col_expr, *calculable_expr, sel_got, selectivity))) {
+        LOG_WARN("Failed to get histogram equal sel", K(ret));
+      }
+    }
     if (OB_SUCC(ret)) {
       if (sel_got) {
       } else if (get_distinct_sel) {
@@ -1775,8 +1902,22 @@ int ObOptEstSel::calc_column_range_selectivity(const ObEstSelInfo& est_sel_info,
   } else if (OB_FAIL(get_var_basic_sel(est_sel_info, column_expr, &distinct_sel, &null_sel, &rows, &minobj, &maxobj))) {
     LOG_WARN("Failed to get var basic sel", K(ret));
   } else if (OB_DEFAULT_STAT_EST != est_type && rows > 0 && minobj.is_valid_type() && maxobj.is_valid_type()) {
+    bool sel_got = false;
     if (startobj->is_null() && endobj->is_null()) {
       selectivity = null_sel;
+    } else if (!startobj->is_null() && !endobj->is_null() && column_expr.is_column_ref_expr() &&
+               OB_FAIL(get_histogram_range_sel(est_sel_info,
+                   static_cast<const ObColumnRefRawExpr&>(column_expr),
+                   *startobj,
+                   *endobj,
+                   border_flag,
+                   null_sel,
+                   sel_got,
+                   last_column,
+                   selectivity))) {
+      LOG_WARN("Failed to get histogram range sel", K(ret));
+    } else if (sel_got) {
+      LOG_TRACE("[RANGE COL SEL] histogram range sel", K(selectivity), K(last_column));
     } else {
       ObObj minscalar;
       ObObj maxscalar;
@@ -42,6 +42,8 @@ class ObSchemaGetterGuard;
 namespace common {
 class ObStatManager;
 class ObColumnStatValueHandle;
+class ObOptColumnStatHandle;
+class ObHistogram;
 }  // namespace common
 namespace sql {
 class ObRawExpr;
@@ -555,6 +557,19 @@ private:
 
   static int get_var_basic_default(double& distinct_num, double& null_num, double& row_count, double& origin_row_count);
 
+  // histogram of the partition used for statistics, NULL if the column has none
+  static int get_column_histogram(const ObEstSelInfo& est_sel_info, const ObColumnRefRawExpr& col_var,
+      common::ObOptColumnStatHandle& handle, const common::ObHistogram*& histogram);
+
+  // col = const by histogram, sel_got is false if there is no histogram or const is not calculable
+  static int get_histogram_equal_sel(const ObEstSelInfo& est_sel_info, const ObColumnRefRawExpr& col_var,
+      const ObRawExpr& calculable_expr, bool& sel_got, double& selectivity);
+
+  // range of col by histogram, null_sel is the null selectivity of col
+  static int get_histogram_range_sel(const ObEstSelInfo& est_sel_info, const ObColumnRefRawExpr& col_var,
+      const common::ObObj& startobj, const common::ObObj& endobj, const common::ObBorderFlag border_flag,
+      const double null_sel, bool& sel_got, bool& last_column, double& selectivity);
+
   // col RANGE_CMP const, column_range_sel
   // func(col) RANGE_CMP const, DEFAULT_INEQ_SEL
   // col1 RANGE_CMP col2, DEFAULT_INEQ_SEL
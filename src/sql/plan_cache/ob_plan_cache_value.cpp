@@ -1124,15 +1124,17 @@ int ObPlanCacheValue::match(ObPlanCacheCtx& pc_ctx, const ObIArray<PCVSchemaObj>
         ret = OB_INVALID_ARGUMENT;
         LOG_WARN("invalid argument", K(ps_param));
       } else if (!not_param_var_[i].ps_param_.can_compare(*ps_param)) {
+        // a mismatch only means another pcv or a new plan is needed, it happens on every execution
+        // of a statement with several not param values, so do not log it as warning.
         is_same = false;
-        LOG_WARN("can not compare", K(not_param_var_[i].ps_param_), K(*ps_param), K(i));
+        LOG_DEBUG("can not compare", K(not_param_var_[i].ps_param_), K(*ps_param), K(i));
       } else if (not_param_var_[i].ps_param_.is_string_type() &&
                  not_param_var_[i].ps_param_.get_collation_type() != ps_param->get_collation_type()) {
         is_same = false;
-        LOG_WARN("can not compare", K(not_param_var_[i].ps_param_), K(*ps_param), K(i));
+        LOG_DEBUG("can not compare", K(not_param_var_[i].ps_param_), K(*ps_param), K(i));
       } else if (0 != not_param_var_[i].ps_param_.compare(*ps_param)) {
         is_same = false;
-        LOG_WARN("match not param var", K(not_param_var_[i]), K(ps_param), K(i));
+        LOG_DEBUG("match not param var", K(not_param_var_[i]), K(ps_param), K(i));
       }
       LOG_DEBUG("match", K(not_param_var_[i].idx_), K(not_param_var_[i].ps_param_), KPC(ps_param));
     }
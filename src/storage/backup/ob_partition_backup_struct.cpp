@@ -149,7 +149,7 @@ bool ObBackupPGMetaInfo::is_valid() const
 
 /**********************ObBackupTableMacroIndex***********************/
 OB_SERIALIZE_MEMBER(ObBackupTableMacroIndex, sstable_macro_index_, data_version_, data_seq_, backup_set_id_,
-    sub_task_id_, offset_, data_length_);
+    sub_task_id_, offset_, data_length_, data_checksum_);
 
 ObBackupTableMacroIndex::ObBackupTableMacroIndex()
     : sstable_macro_index_(0),
@@ -159,6 +159,7 @@ ObBackupTableMacroIndex::ObBackupTableMacroIndex()
       sub_task_id_(0),
       offset_(0),
       data_length_(0),
+      data_checksum_(0),
       table_key_ptr_(NULL)
 {}
 
@@ -171,6 +172,7 @@ void ObBackupTableMacroIndex::reset()
   sub_task_id_ = 0;
   offset_ = 0;
   data_length_ = 0;
+  data_checksum_ = 0;
   table_key_ptr_ = NULL;
 }
 
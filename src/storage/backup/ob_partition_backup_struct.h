@@ -81,7 +81,7 @@ public:
   void reset();
   bool is_valid() const;
   TO_STRING_KV(K_(sstable_macro_index), K_(data_version), K_(data_seq), K_(backup_set_id), K_(sub_task_id), K_(offset),
-      K_(data_length), KP_(table_key_ptr));
+      K_(data_length), K_(data_checksum), KP_(table_key_ptr));
 
   // need serialize
   int64_t sstable_macro_index_;
@@ -91,6 +91,7 @@ public:
   int64_t sub_task_id_;
   int64_t offset_;
   int64_t data_length_;  //=ObBackupDataHeader(header_length_+macro_meta_length_ + macro_data_length_)
+  int64_t data_checksum_;  // data checksum of macro block, 0 for indexes written by older versions
   // no need serialize
   const ObITable::TableKey* table_key_ptr_;
 };
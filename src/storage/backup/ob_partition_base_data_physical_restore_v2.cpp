@@ -1629,7 +1629,12 @@ int ObPGPartitionBaseDataMetaRestoreReaderV2::check_sstable_ids_contain_schema_t
 
 /***********************ObPhyRestoreMacroIndexStoreV1***************************/
 ObPhyRestoreMacroIndexStoreV2::ObPhyRestoreMacroIndexStoreV2()
-    : is_inited_(false), allocator_(ObModIds::RESTORE), index_map_(), backup_task_id_(-1), table_keys_ptr_()
+    : is_inited_(false),
+      allocator_(ObModIds::RESTORE),
+      index_map_(),
+      major_logic_map_(),
+      backup_task_id_(-1),
+      table_keys_ptr_()
 {}
 
 ObPhyRestoreMacroIndexStoreV2::~ObPhyRestoreMacroIndexStoreV2()
@@ -1639,6 +1644,7 @@ ObPhyRestoreMacroIndexStoreV2::~ObPhyRestoreMacroIndexStoreV2()
 
 void ObPhyRestoreMacroIndexStoreV2::reset()
 {
+  major_logic_map_.destroy();
   index_map_.clear();
   allocator_.reset();
   is_inited_ = false;
@@ -1847,11 +1853,14 @@ int ObPhyRestoreMacroIndexStoreV2::init(const int64_t backup_task_id, const comm
     STORAGE_LOG(WARN, "get backup base data info fail", K(ret));
   } else if (OB_FAIL(init_major_macro_index(pkey, path_info, restore_status))) {
     STORAGE_LOG(WARN, "failed to init major macro index", K(ret), K(pkey), K(path_info));
+  } else if (OB_FAIL(init_major_logic_map())) {
+    STORAGE_LOG(WARN, "failed to init major logic map", K(ret), K(pkey));
   }
 
   if (OB_SUCC(ret)) {
     is_inited_ = true;
   } else {
+    major_logic_map_.destroy();
     index_map_.clear();
   }
   return ret;
@@ -2146,6 +2155,73 @@ int ObPhyRestoreMacroIndexStoreV2::get_major_macro_index_array(
   return ret;
 }
 
+int ObPhyRestoreMacroIndexStoreV2::get_major_macro_index(
+    const blocksstable::ObMajorMacroBlockKey &key, ObBackupTableMacroIndex &macro_index) const
+{
+  int ret = OB_SUCCESS;
+  const ObBackupTableMacroIndex *index = NULL;
+  macro_index.reset();
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    STORAGE_LOG(WARN, "macro index store do not init", K(ret));
+  } else if (!key.is_valid()) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "get major macro index get invalid argument", K(ret), K(key));
+  } else if (!major_logic_map_.created()) {
+    ret = OB_NOT_SUPPORTED;
+    STORAGE_LOG(WARN, "major logic map is only built for backup", K(ret), K(key));
+  } else if (OB_FAIL(major_logic_map_.get_refactored(key, index))) {
+    if (OB_HASH_NOT_EXIST != ret) {
+      STORAGE_LOG(WARN, "failed to get major macro index", K(ret), K(key));
+    }
+  } else if (OB_ISNULL(index)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "major macro index should not be NULL", K(ret), K(key));
+  } else {
+    macro_index = *index;
+  }
+  return ret;
+}
+
+int ObPhyRestoreMacroIndexStoreV2::init_major_logic_map()
+{
+  int ret = OB_SUCCESS;
+  blocksstable::ObMajorMacroBlockKey key;
+  if (OB_FAIL(major_logic_map_.create(BUCKET_SIZE, ObModIds::BACKUP))) {
+    STORAGE_LOG(WARN, "failed to create major logic map", K(ret));
+  }
+  for (MacroIndexMap::const_iterator iter = index_map_.begin(); OB_SUCC(ret) && iter != index_map_.end(); ++iter) {
+    const ObITable::TableKey &table_key = iter->first;
+    const ObArray<ObBackupTableMacroIndex> *index_list = iter->second;
+    if (!table_key.is_major_sstable() || table_key.is_trans_sstable()) {
+      // only major macro blocks can be reused
+    } else if (OB_ISNULL(index_list)) {
+      ret = OB_ERR_UNEXPECTED;
+      STORAGE_LOG(WARN, "index list should not be NULL", K(ret), K(table_key));
+    } else {
+      for (int64_t i = 0; OB_SUCC(ret) && i < index_list->count(); ++i) {
+        const ObBackupTableMacroIndex &index = index_list->at(i);
+        key.table_id_ = table_key.table_id_;
+        key.partition_id_ = table_key.pkey_.get_partition_id();
+        key.data_version_ = index.data_version_;
+        key.data_seq_ = index.data_seq_;
+        // major sstables of different versions share the same backup of a reused macro block
+        if (OB_FAIL(major_logic_map_.set_refactored(key, &index))) {
+          if (OB_HASH_EXIST == ret) {
+            ret = OB_SUCCESS;
+          } else {
+            STORAGE_LOG(WARN, "failed to set major logic map", K(ret), K(key));
+          }
+        }
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    STORAGE_LOG(INFO, "succeed to init major logic map", "macro_count", major_logic_map_.size());
+  }
+  return ret;
+}
+
 int ObPhyRestoreMacroIndexStoreV2::get_table_key_ptr(
     const ObITable::TableKey &table_key, const ObITable::TableKey *&table_key_ptr)
 {
@@ -52,6 +52,8 @@ public:
   }
   virtual bool is_inited() const;
   int check_table_exist(const ObITable::TableKey &table_key, bool &is_exist) const;
+  // find the backup of a major macro block by its logic id, only for stores inited for incremental backup
+  int get_major_macro_index(const blocksstable::ObMajorMacroBlockKey &key, ObBackupTableMacroIndex &macro_index) const;
 
   TO_STRING_KV(K_(is_inited));
 
@@ -69,13 +71,16 @@ private:
       const ObITable::TableKey &table_key, const common::ObIArray<ObBackupTableMacroIndex> &index_list);
   int init_one_file(const ObString &path, const ObString &storage_info);
   int get_table_key_ptr(const ObITable::TableKey &table_key, const ObITable::TableKey *&table_key_ptr);
+  int init_major_logic_map();
 
 private:
   static const int64_t BUCKET_SIZE = 100000;  // 10w
   typedef common::hash::ObHashMap<ObITable::TableKey, common::ObArray<ObBackupTableMacroIndex> *> MacroIndexMap;
+  typedef common::hash::ObHashMap<blocksstable::ObMajorMacroBlockKey, const ObBackupTableMacroIndex *> MajorLogicMap;
   bool is_inited_;
   common::ObArenaAllocator allocator_;
   MacroIndexMap index_map_;
+  MajorLogicMap major_logic_map_;  // points into index_map_, read only after init
   int64_t backup_task_id_;
   ObArray<ObITable::TableKey *> table_keys_ptr_;
   DISALLOW_COPY_AND_ASSIGN(ObPhyRestoreMacroIndexStoreV2);
@@ -13,6 +13,7 @@
 #include "ob_tmp_file_store.h"
 #include "ob_tmp_file.h"
 #include "share/ob_task_define.h"
+#include "share/config/ob_server_config.h"
 
 using namespace oceanbase::share;
 
@@ -1223,10 +1224,19 @@ int ObTmpFileStore::alloc(const int64_t dir_id, const uint64_t tenant_id, const
   return ret;
 }
 
+void ObTmpFileStore::set_io_category(common::ObIODesc& io_desc)
+{
+  // spilling goes to its own io channel and quota, instead of queuing with user reads
+  if (GCONF._temporary_file_io_percentage > 0) {
+    io_desc.category_ = common::TMP_FILE_IO;
+  }
+}
+
 int ObTmpFileStore::read(const uint64_t tenant_id, ObTmpBlockIOInfo& io_info, ObTmpFileIOHandle& handle)
 {
   int ret = OB_SUCCESS;
   ObTmpTenantFileStore* store = NULL;
+  set_io_category(io_info.io_desc_);
   if (OB_FAIL(get_store(tenant_id, store))) {
     STORAGE_LOG(WARN, "fail to get tmp tenant file store", K(ret), K(tenant_id), K(tenant_id), K(io_info), K(handle));
   } else if (OB_FAIL(store->read(io_info, handle))) {
@@ -1239,9 +1249,11 @@ int ObTmpFileStore::write(const uint64_t tenant_id, const ObTmpBlockIOInfo& io_i
 {
   int ret = OB_SUCCESS;
   ObTmpTenantFileStore* store = NULL;
+  ObTmpBlockIOInfo info(io_info);
+  set_io_category(info.io_desc_);
   if (OB_FAIL(get_store(tenant_id, store))) {
     STORAGE_LOG(WARN, "fail to get tmp tenant file store", K(ret), K(tenant_id), K(io_info));
-  } else if (OB_FAIL(store->write(io_info))) {
+  } else if (OB_FAIL(store->write(info))) {
     STORAGE_LOG(WARN, "fail to write the extent", K(ret), K(tenant_id), K(io_info));
   }
   return ret;
@@ -336,6 +336,7 @@ private:
   ObTmpFileStore();
   virtual ~ObTmpFileStore();
   int get_store(const uint64_t tenant_id, ObTmpTenantFileStore*& store);
+  static void set_io_category(common::ObIODesc& io_desc);
 
 private:
   static const uint64_t STORE_HASH_BUCKET_NUM = 1543L;
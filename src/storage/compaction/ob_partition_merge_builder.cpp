@@ -13,6 +13,7 @@
 #define USING_LOG_PREFIX STORAGE_COMPACTION
 #include "ob_partition_merge_util.h"
 #include "share/stat/ob_stat_manager.h"
+#include "share/stat/ob_histogram_builder.h"
 #include "storage/ob_row_fuse.h"
 #include "storage/ob_sstable.h"
 #include "storage/memtable/ob_memtable_interface.h"
@@ -754,7 +755,9 @@ ObMacroBlockEstimator::ObMacroBlockEstimator()
 {}
 
 ObMacroBlockEstimator::~ObMacroBlockEstimator()
-{}
+{
+  destroy_histogram_builders();
+}
 
 int ObMacroBlockEstimator::open(storage::ObSSTableMergeCtx& ctx, const int64_t idx, const bool iter_complement,
     const ObIArray<ObColDesc>& column_ids, const ObIArray<ObMacroBlockInfoPair>* lob_blocks)
@@ -777,6 +780,7 @@ int ObMacroBlockEstimator::open(storage::ObSSTableMergeCtx& ctx, const int64_t i
     stat_sampling_count_ = 0;
     partition_id_ = ctx.param_.pkey_.get_partition_id();
     merge_context_ = &(ctx.merge_context_);
+    destroy_histogram_builders();
     allocator_.reuse();
     int tmp_ret = OB_SUCCESS;
     ObSEArray<ObColDesc, OB_DEFAULT_SE_ARRAY_COUNT> column_ids;
@@ -803,6 +807,19 @@ int ObMacroBlockEstimator::open(storage::ObSSTableMergeCtx& ctx, const int64_t i
         stat_ptr = NULL;
       }
     }
+    ObHistogramBuilder* builder = NULL;
+    for (int64_t i = 0; OB_SUCCESS == tmp_ret && !ctx.histogram_builders_.empty() && i < column_ids.count(); ++i) {
+      if (OB_ISNULL(ptr = allocator_.alloc(sizeof(ObHistogramBuilder)))) {
+        tmp_ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("fail to allocate memory for histogram builder", K(tmp_ret));
+      } else if (FALSE_IT(builder = new (ptr) ObHistogramBuilder())) {
+      } else if (OB_SUCCESS != (tmp_ret = histogram_builders_.push_back(builder))) {
+        LOG_WARN("fail to push back histogram builder", K(tmp_ret));
+        builder->~ObHistogramBuilder();
+      }
+      ptr = NULL;
+      builder = NULL;
+    }
     if (OB_UNLIKELY(OB_SUCCESS != tmp_ret)) {
       stat_sampling_ratio_ = 0;
     }
@@ -889,6 +906,9 @@ int ObMacroBlockEstimator::update_estimator(const storage::ObStoreRow& row)
         // skip json
       } else if (OB_FAIL(column_stats_.at(i)->add_value(row.row_val_.cells_[i]))) {
         LOG_WARN("fill column stat error.", K(ret), K(i), K(row.row_val_.cells_[i]));
+      } else if (!histogram_builders_.empty() &&
+                 OB_FAIL(histogram_builders_.at(i)->add_value(row.row_val_.cells_[i]))) {
+        LOG_WARN("fill histogram sample error.", K(ret), K(i), K(row.row_val_.cells_[i]));
       }
     }
   }
@@ -906,6 +926,9 @@ int ObMacroBlockEstimator::close()
   } else if (nullptr != merge_context_) {
     // ignore ret
     (void)merge_context_->add_column_stats(column_stats_);
+    if (!histogram_builders_.empty()) {
+      (void)merge_context_->add_histogram_builders(histogram_builders_);
+    }
   }
   return ret;
 }
@@ -917,12 +940,23 @@ void ObMacroBlockEstimator::reset()
   stat_sampling_ratio_ = 0;
   stat_sampling_count_ = 0;
   column_stats_.reuse();
+  destroy_histogram_builders();
   allocator_.reuse();
   if (NULL != component_) {
     component_->reset();
   }
 }
 
+void ObMacroBlockEstimator::destroy_histogram_builders()
+{
+  for (int64_t i = 0; i < histogram_builders_.count(); ++i) {
+    if (NULL != histogram_builders_.at(i)) {
+      histogram_builders_.at(i)->~ObHistogramBuilder();
+    }
+  }
+  histogram_builders_.reuse();
+}
+
 void ObMacroBlockEstimator::set_purged_count(const int64_t count)
 {
   if (NULL != component_) {
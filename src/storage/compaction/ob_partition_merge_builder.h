@@ -26,6 +26,9 @@
 #include "storage/blocksstable/ob_bloom_filter_data_reader.h"
 
 namespace oceanbase {
+namespace common {
+class ObHistogramBuilder;
+}
 namespace storage {
 struct ObSSTableMergeInfo;
 class ObPartitionStorage;
@@ -143,12 +146,15 @@ public:
 
 private:
   int update_estimator(const storage::ObStoreRow& row);
+  void destroy_histogram_builders();
   ObIStoreRowProcessor* component_;
   bool is_opened_;
   int64_t partition_id_;
   int64_t stat_sampling_ratio_;
   int64_t stat_sampling_count_;
   common::ObArray<common::ObColumnStat*> column_stats_;
+  // empty unless the merge builds histograms
+  common::ObArray<common::ObHistogramBuilder*> histogram_builders_;
   storage::ObSSTableMergeContext* merge_context_;
   common::ObArenaAllocator allocator_;
 };
@@ -498,6 +498,19 @@ int ObQueryEngine::get(const ObMemtableKey* parameter_key, ObMvccRow*& row, ObMe
   return ret;
 }
 
+void ObQueryEngine::prefetch(const uint64_t table_id, const ObStoreRowkey* rowkey, const bool touch_list)
+{
+  TableIndexNode* node_ptr = nullptr;
+  if (IS_NOT_INIT || OB_ISNULL(rowkey)) {
+    // do nothing
+  } else if (OB_SUCCESS != get_table_index_node(table_id, node_ptr) || OB_ISNULL(node_ptr)) {
+    // do nothing
+  } else {
+    const ObStoreRowkeyWrapper key_wrapper(rowkey);
+    node_ptr->get_keyhash().prefetch(&key_wrapper, touch_list);
+  }
+}
+
 int ObQueryEngine::ensure(const ObMemtableKey* key, ObMvccRow* value)
 {
   int ret = OB_SUCCESS;
@@ -280,6 +280,8 @@ public:
   }
   int set(const ObMemtableKey* key, ObMvccRow* value);
   int get(const ObMemtableKey* parameter_key, ObMvccRow*& row, ObMemtableKey* returned_key);
+  // hint for batched gets, see ObMtHash::prefetch
+  void prefetch(const uint64_t table_id, const ObStoreRowkey* rowkey, const bool touch_list);
   int ensure(const ObMemtableKey* key, ObMvccRow* value);
   int skip_gap(const ObMemtableKey* start, const ObStoreRowkey*& end, int64_t version, bool is_reverse, int64_t& size);
   int check_and_purge(const ObMemtableKey* key, ObMvccRow* row, int64_t version, bool& purged);
@@ -537,6 +537,7 @@ int ObMemtableMGetIterator::inner_get_next_row(const ObStoreRow*& row)
   } else {
     if (rowkey_iter_ >= rowkeys_->count()) {
       ret = OB_ITER_END;
+    } else if (FALSE_IT(prefetch_rowkeys_())) {
     } else if (OB_FAIL(memtable_->get(*param_, *context_, rowkeys_->at(rowkey_iter_), cur_row_))) {
       TRANS_LOG(WARN, "memtable get fail", K(ret), "table_id", param_->table_id_, "rowkey", rowkeys_->at(rowkey_iter_));
     } else {
@@ -548,6 +549,31 @@ int ObMemtableMGetIterator::inner_get_next_row(const ObStoreRow*& row)
   return ret;
 }
 
+// Each get walks the hash bucket and then the bucket list, both are dependent cache misses
+// for a large memtable. Keys of a multi get are known in advance, so the misses of the
+// upcoming keys are issued as a pipeline and overlap with the current get.
+void ObMemtableMGetIterator::prefetch_rowkeys_()
+{
+  if (rowkeys_->count() > 1) {
+    if (0 == rowkey_iter_) {
+      for (int64_t i = 0; i < 2 * PREFETCH_DISTANCE; i++) {
+        prefetch_rowkey_(i, false);
+      }
+    } else {
+      prefetch_rowkey_(rowkey_iter_ + 2 * PREFETCH_DISTANCE - 1, false);
+    }
+    prefetch_rowkey_(rowkey_iter_ + PREFETCH_DISTANCE, true);
+  }
+}
+
+void ObMemtableMGetIterator::prefetch_rowkey_(const int64_t idx, const bool touch_list)
+{
+  if (idx < rowkeys_->count()) {
+    static_cast<ObMemtable*>(memtable_)->get_query_engine().prefetch(
+        param_->table_id_, &(rowkeys_->at(idx).get_store_rowkey()), touch_list);
+  }
+}
+
 void ObMemtableMGetIterator::reset()
 {
   is_inited_ = false;
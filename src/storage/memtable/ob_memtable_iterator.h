@@ -220,6 +220,13 @@ public:
 public:
   static const int64_t ROW_ALLOCATOR_PAGE_SIZE = common::OB_MALLOC_NORMAL_BLOCK_SIZE;
 
+private:
+  // the hash bucket of a key is prefetched 2 * PREFETCH_DISTANCE gets ahead of it,
+  // and the head of the bucket list PREFETCH_DISTANCE gets ahead of it
+  static const int64_t PREFETCH_DISTANCE = 4;
+  void prefetch_rowkey_(const int64_t idx, const bool touch_list);
+  void prefetch_rowkeys_();
+
 private:
   // means MGETITER
   static const uint64_t VALID_MAGIC_NUM = 0x524554495445474d;
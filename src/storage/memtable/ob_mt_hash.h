@@ -183,6 +183,19 @@ public:
     }
     return ret;
   }
+  // same as at(), but never allocates dir_/seg, return NULL if not ready
+  OB_INLINE ObHashNode* peek(const int64_t idx) const
+  {
+    ObHashNode* ret_node = NULL;
+    ObHashNode** dir = ATOMIC_LOAD(&dir_);
+    if (OB_NOT_NULL(dir) && reinterpret_cast<ObHashNode**>(PLACE_HOLDER) != dir) {
+      ObHashNode* seg = ATOMIC_LOAD(dir + idx / SEG_SIZE);
+      if (OB_NOT_NULL(seg) && PLACE_HOLDER != seg) {
+        ret_node = seg + (idx % SEG_SIZE);
+      }
+    }
+    return ret_node;
+  }
   int64_t to_string(char* buf, int64_t buf_len) const
   {
     return snprintf(buf, buf_len, ", dir_=%p", dir_);
@@ -289,6 +302,10 @@ public:
     }
     return ret;
   }
+  OB_INLINE ObHashNode* peek(const int64_t idx) const
+  {
+    return idx < SMALL_CAPABILITY ? small_arr_.peek(idx) : large_arr_.peek(idx);
+  }
   int64_t to_string(char* buf, int64_t buf_len) const
   {
     int64_t len = small_arr_.to_string(buf, buf_len);
@@ -401,6 +418,33 @@ public:
     return ret;
   }
 
+  // Software prefetch for batched gets, never allocates dir/seg and never fills buckets.
+  // Called twice for a key some lookups ahead of it: the first call touches the bucket node,
+  // the second one reads the cached bucket and touches the head of its sub-range list.
+  void prefetch(const Key* query_key, const bool touch_list)
+  {
+    if (!is_empty()) {
+      const uint64_t query_key_so_hash = bitrev(mark_hash(query_key->hash()));
+      const int64_t arr_size = ATOMIC_LOAD(&arr_size_);
+      const int64_t bucket_count = next2n(arr_size);
+      int64_t arr_idx = get_arr_idx(query_key_so_hash, bucket_count);
+      if (arr_idx >= arr_size) {
+        arr_idx = get_arr_idx(query_key_so_hash, bucket_count >> 1);
+      }
+      ObHashNode* bucket_node = (0 == arr_idx) ? &zero_node_ : arr_.peek(arr_idx);
+      if (OB_ISNULL(bucket_node)) {
+        // dir/seg is not allocated, get() will go to the parent bucket
+      } else if (!touch_list) {
+        __builtin_prefetch(bucket_node, 0 /* read */, 3 /* keep in all cache levels */);
+      } else if (bucket_node->is_bucket_filled()) {
+        ObHashNode* next_node = ATOMIC_LOAD(&(bucket_node->next_));
+        if (not_reach_list_tail(next_node)) {
+          __builtin_prefetch(next_node, 0 /* read */, 3 /* keep in all cache levels */);
+        }
+      }
+    }
+  }
+
   int insert(const Key* insert_key, const ObMvccRow* insert_value)
   {
     int ret = common::OB_SUCCESS;
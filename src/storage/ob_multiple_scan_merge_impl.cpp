@@ -19,7 +19,14 @@ using namespace oceanbase::common;
 using namespace oceanbase::share;
 
 ObMultipleScanMergeImpl::ObMultipleScanMergeImpl()
-    : tree_cmp_(), loser_tree_(tree_cmp_), iter_del_row_(false), consumer_(), try_push_top_item_(false)
+    : tree_cmp_(),
+      loser_tree_(tree_cmp_),
+      iter_del_row_(false),
+      consumer_(),
+      try_push_top_item_(false),
+      stream_iter_idx_(-1),
+      has_stream_bound_(false),
+      stream_bound_()
 {}
 
 ObMultipleScanMergeImpl::~ObMultipleScanMergeImpl()
@@ -33,6 +40,7 @@ void ObMultipleScanMergeImpl::reset()
   iter_del_row_ = false;
   consumer_.reset();
   try_push_top_item_ = false;
+  reset_stream();
 }
 
 void ObMultipleScanMergeImpl::reuse()
@@ -42,6 +50,7 @@ void ObMultipleScanMergeImpl::reuse()
   iter_del_row_ = false;
   consumer_.reset();
   try_push_top_item_ = false;
+  reset_stream();
 }
 
 int ObMultipleScanMergeImpl::init(
@@ -226,7 +235,7 @@ int ObMultipleScanMergeImpl::try_skip_range(const ObStoreRow* row, int idx, uint
       STORAGE_LOG(ERROR, "memtable context is null, unexpected error", K(ret), KP(mem_ctx));
     } else {
       bool read_elr_data = mem_ctx->has_read_elr_data();
-      if (ObClockGenerator::getClock() - row->last_purge_ts_ > 5000000) {
+      if (ObClockGenerator::getClock() - row->last_purge_ts_ > RANGE_PURGE_INTERVAL_US) {
         range_purger_.try_purge(row->scan_index_, idx, is_del, read_elr_data);
         const_cast<ObStoreRow*>(row)->last_purge_ts_ = ObClockGenerator::getClock();
       }
@@ -309,7 +318,11 @@ int ObMultipleScanMergeImpl::inner_get_next_row(ObStoreRow& row)
     ret = OB_ITER_END;
   } else {
     while (OB_SUCC(ret) && need_retry) {
-      if (OB_FAIL(supply_consume())) {
+      if (stream_iter_idx_ >= 0) {
+        if (OB_FAIL(get_next_stream_row(row, need_retry))) {
+          STORAGE_LOG(WARN, "fail to get next stream row", K(ret), K_(stream_iter_idx));
+        }
+      } else if (OB_FAIL(supply_consume())) {
         if (OB_UNLIKELY(OB_ITER_END != ret)) {
           STORAGE_LOG(WARN, "supply consume failed", K(ret));
         }
@@ -317,6 +330,8 @@ int ObMultipleScanMergeImpl::inner_get_next_row(ObStoreRow& row)
         ret = OB_ITER_END;
       } else if (OB_FAIL(ObMultipleScanMergeImpl::inner_get_next_row(row, need_retry))) {
         STORAGE_LOG(WARN, "fail to inner get next row from ObMultipleScanMergeHelper", K(ret));
+      } else if (try_push_top_item_ && !iter_del_row_ && OB_FAIL(try_start_stream())) {
+        STORAGE_LOG(WARN, "fail to start stream", K(ret));
       } else {
         // succeed to get next row
       }
@@ -434,10 +449,114 @@ int ObMultipleScanMergeImpl::inner_get_next_row(ObStoreRow& row, bool& need_retr
   return ret;
 }
 
+int ObMultipleScanMergeImpl::try_start_stream()
+{
+  int ret = OB_SUCCESS;
+  const ObScanMergeLoserTreeItem* bound_item = nullptr;
+  if (OB_UNLIKELY(1 != consumer_.get_consumer_num())) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "try_push_top_item_ mismatch", K(ret), K_(consumer));
+  } else if (loser_tree_.empty()) {
+    // the other iterators are all ended
+    has_stream_bound_ = false;
+  } else if (OB_FAIL(loser_tree_.top(bound_item))) {
+    STORAGE_LOG(WARN, "get loser tree top item fail", K(ret));
+  } else if (OB_ISNULL(bound_item) || OB_ISNULL(bound_item->row_)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "item or row is null", K(ret), KP(bound_item));
+  } else {
+    // the row is not changed before its iterator is consumed again
+    stream_bound_ = *bound_item;
+    has_stream_bound_ = true;
+  }
+
+  if (OB_SUCC(ret)) {
+    stream_iter_idx_ = consumer_.get_consumer_iters()[0];
+    consumer_.set_consumer_num(0);
+    try_push_top_item_ = false;
+  }
+  return ret;
+}
+
+int ObMultipleScanMergeImpl::stop_stream(const ObScanMergeLoserTreeItem* item)
+{
+  int ret = OB_SUCCESS;
+  // the item is not before the bound, the loser tree has to decide its turn
+  if (nullptr != item && OB_FAIL(loser_tree_.push(*item))) {
+    STORAGE_LOG(WARN, "loser tree push error", K(ret), K(*item));
+  } else {
+    reset_stream();
+  }
+  return ret;
+}
+
+int ObMultipleScanMergeImpl::get_next_stream_row(ObStoreRow& row, bool& need_retry)
+{
+  int ret = OB_SUCCESS;
+  ObScanMergeLoserTreeItem item;
+  ObStoreRowIterator* iter = nullptr;
+  bool can_stream = false;
+  bool final_result = false;
+
+  need_retry = false;
+  if (OB_UNLIKELY(stream_iter_idx_ < 0 || stream_iter_idx_ >= iters_.count())) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "invalid stream iter idx", K(ret), K_(stream_iter_idx), K(iters_.count()));
+  } else if (OB_ISNULL(iter = iters_.at(stream_iter_idx_))) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "Unexpected null iter", K(ret), K_(stream_iter_idx));
+  } else if (OB_FAIL(iter->get_next_row_ext(item.row_, item.iter_flag_))) {
+    if (OB_ITER_END != ret) {
+      STORAGE_LOG(WARN, "failed to get next row from iterator", K(ret), K_(stream_iter_idx), K(*iter));
+    } else if (OB_FAIL(stop_stream(nullptr))) {
+      STORAGE_LOG(WARN, "fail to stop stream", K(ret));
+    } else {
+      need_retry = true;
+    }
+  } else if (OB_ISNULL(item.row_)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "get next row return NULL row", K(ret), K_(stream_iter_idx));
+  } else {
+    item.iter_idx_ = stream_iter_idx_;
+    0 == item.iter_idx_ ? ++row_stat_.inc_row_count_ : ++row_stat_.base_row_count_;
+    range_purger_.on_push((int)item.iter_idx_, item.iter_flag_);
+    // delete rows and rows due to purge memtable go through the loser tree for range skip and purge
+    can_stream = common::ObActionFlag::OP_ROW_EXIST == item.row_->flag_ &&
+                 ObClockGenerator::getClock() - item.row_->last_purge_ts_ <= RANGE_PURGE_INTERVAL_US;
+    if (can_stream && has_stream_bound_) {
+      can_stream = tree_cmp_(item, stream_bound_) < 0;
+      if (OB_FAIL(tree_cmp_.get_error_code())) {
+        STORAGE_LOG(WARN, "compare item fail", K(ret), K(item), K_(stream_bound));
+      }
+    }
+
+    if (OB_FAIL(ret)) {
+    } else if (!can_stream) {
+      if (OB_FAIL(stop_stream(&item))) {
+        STORAGE_LOG(WARN, "fail to stop stream", K(ret));
+      } else {
+        need_retry = true;
+      }
+    } else {
+      row.row_val_.count_ = 0;
+      row.flag_ = common::ObActionFlag::OP_ROW_DOES_NOT_EXIST;
+      row.from_base_ = false;
+      row.scan_index_ = item.row_->scan_index_;
+      if (OB_FAIL(ObRowFuse::fuse_row(*item.row_, row, nop_pos_, final_result))) {
+        STORAGE_LOG(WARN, "failed to fuse row", K(ret), K(*item.row_));
+      } else {
+        ++row_stat_.result_row_count_;
+      }
+    }
+  }
+  return ret;
+}
+
 int ObMultipleScanMergeImpl::prepare_loser_tree()
 {
   int ret = common::OB_SUCCESS;
   try_push_top_item_ = false;
+  reset_stream();
   loser_tree_.reset();
   return ret;
 }
@@ -109,8 +109,20 @@ protected:
   int inner_get_next_row(ObStoreRow& row, bool& need_retry);
   int prepare_loser_tree();
 
+private:
+  static const int64_t RANGE_PURGE_INTERVAL_US = 5000000;  // 5s
+
 private:
   int try_skip_range(const ObStoreRow* row, int idx, uint8_t flag, bool first_pop, bool& skipped);
+  int try_start_stream();
+  int stop_stream(const ObScanMergeLoserTreeItem* item);
+  int get_next_stream_row(ObStoreRow& row, bool& need_retry);
+  OB_INLINE void reset_stream()
+  {
+    stream_iter_idx_ = -1;
+    has_stream_bound_ = false;
+    stream_bound_.reset();
+  }
 
 protected:
   ObScanMergeLoserTreeCmp tree_cmp_;
@@ -121,6 +133,13 @@ protected:
   ObRangePurger range_purger_;
   ObRangeSkip range_skip_;
 
+private:
+  // rows of stream_iter_idx_ are output without the loser tree while they are before stream_bound_,
+  // the top row of the other iterators, the other iterators are not touched until the stream stops
+  int64_t stream_iter_idx_;
+  bool has_stream_bound_;
+  ObScanMergeLoserTreeItem stream_bound_;
+
 private:
   DISALLOW_COPY_AND_ASSIGN(ObMultipleScanMergeImpl);
 };
@@ -1715,6 +1715,7 @@ int ObBackupFileAppender::append_macroblock_data(blocksstable::ObFullMacroBlockM
       STORAGE_LOG(WARN, "macro meta version not match", K(ret), K(macro_index), K(macro_meta));
     } else {
       macro_index.data_length_ = file_offset_ - macro_index.offset_;  // include common header
+      macro_index.data_checksum_ = macro_meta.meta_->data_checksum_;
       if (macro_index.data_length_ < backup_macro_data.get_serialize_size() + sizeof(ObBackupCommonHeader)) {
         ret = OB_ERR_SYS;
         STORAGE_LOG(ERROR,
@@ -2457,28 +2458,6 @@ void ObBackupPhysicalPGCtx::SubTask::reset()
   block_count_ = 0;
 }
 
-ObBackupPhysicalPGCtx::MacroIndexMergePoint::MacroIndexMergePoint()
-    : table_id_(OB_INVALID_ID), sstable_idx_(0), macro_index_array_(NULL)
-{}
-
-void ObBackupPhysicalPGCtx::MacroIndexMergePoint::reset()
-{
-  table_id_ = OB_INVALID_ID;
-  sstable_idx_ = 0;
-  macro_index_array_ = NULL;
-}
-
-bool ObBackupPhysicalPGCtx::MacroIndexMergePoint::is_valid() const
-{
-  bool bool_ret = true;
-  if (OB_INVALID_ID == table_id_ || NULL == macro_index_array_) {
-    bool_ret = false;
-  } else if (sstable_idx_ < 0 || sstable_idx_ >= macro_index_array_->count()) {
-    bool_ret = false;
-  }
-  return bool_ret;
-}
-
 ObBackupPhysicalPGCtx::MacroIndexRetryPoint::MacroIndexRetryPoint() : table_key_(), last_idx_(-1)
 {}
 
@@ -2617,7 +2596,6 @@ void ObBackupPhysicalPGCtx::reset()
   retry_cnt_ = 0;
 
   task_turn_ = 0;
-  index_merge_point_.reset();
   pg_key_.reset();
   backup_arg_ = NULL;
   find_breakpoint_ = false;
@@ -2801,6 +2779,7 @@ int ObBackupPhysicalPGCtx::fetch_prev_macro_index(const ObPhyRestoreMacroIndexSt
     const ObBackupMacroBlockArg& macro_arg, ObBackupTableMacroIndex& macro_index)
 {
   int ret = OB_SUCCESS;
+  blocksstable::ObMajorMacroBlockKey key;
 
   if (!is_opened_) {
     ret = OB_NOT_OPEN;
@@ -2811,47 +2790,17 @@ int ObBackupPhysicalPGCtx::fetch_prev_macro_index(const ObPhyRestoreMacroIndexSt
     ret = OB_INVALID_ARGUMENT;
     STORAGE_LOG(WARN, "invalid argument", K(ret), K(macro_index_store), K(macro_arg));
   } else {
-    const uint64_t table_id = macro_arg.table_key_ptr_->table_id_;
-    if (table_id != index_merge_point_.table_id_) {
-      index_merge_point_.table_id_ = table_id;
-      index_merge_point_.sstable_idx_ = 0;
-
-      if (OB_FAIL(macro_index_store.get_major_macro_index_array(table_id, index_merge_point_.macro_index_array_))) {
-        STORAGE_LOG(WARN, "get macro index array fail", K(ret), K(table_id));
-      } else if (OB_ISNULL(index_merge_point_.macro_index_array_)) {
-        ret = OB_ERR_UNEXPECTED;
-        STORAGE_LOG(WARN, "macro_index_array_ should not be null here", K(ret), K(table_id), K(index_merge_point_));
-      }
-    }
-    if (OB_SUCC(ret)) {
-      if (OB_UNLIKELY(!index_merge_point_.is_valid())) {
-        ret = OB_INVALID_ARGUMENT;
-        STORAGE_LOG(WARN, "index_merge_point_ is not vaild", K(ret), K(table_id), K(index_merge_point_));
-      } else {
-        int64_t& idx = index_merge_point_.sstable_idx_;
-        const common::ObArray<ObBackupTableMacroIndex>* index_array = index_merge_point_.macro_index_array_;
-        while (OB_SUCC(ret)) {
-          if (idx >= index_array->count()) {
-            ret = OB_ERR_SYS;
-            STORAGE_LOG(WARN, "get prev macro block index fail", K(ret), K(macro_arg), K(idx));
-            break;
-          }
-          const ObBackupTableMacroIndex& tmp_index = index_array->at(idx);
-          if (macro_arg.fetch_arg_.data_version_ == tmp_index.data_version_) {
-            if (macro_arg.fetch_arg_.data_seq_ == tmp_index.data_seq_) {  // reuse
-              macro_index = tmp_index;
-              STORAGE_LOG(DEBUG, "backup macro block reuse", K(macro_index));
-              ++idx;
-              break;
-            } else if (macro_arg.fetch_arg_.data_seq_ < tmp_index.data_seq_) {
-              ret = OB_ERR_UNEXPECTED;
-              STORAGE_LOG(WARN, "", K(ret), K(macro_arg), K(tmp_index));
-              break;
-            }
-          }
-          ++idx;
-        }
+    // look up by logic id, macro blocks reused by major merge keep it in every later major sstable
+    key.table_id_ = macro_arg.table_key_ptr_->table_id_;
+    key.partition_id_ = macro_arg.table_key_ptr_->pkey_.get_partition_id();
+    key.data_version_ = macro_arg.fetch_arg_.data_version_;
+    key.data_seq_ = macro_arg.fetch_arg_.data_seq_;
+    if (OB_FAIL(macro_index_store.get_major_macro_index(key, macro_index))) {
+      if (OB_HASH_NOT_EXIST != ret) {
+        STORAGE_LOG(WARN, "get prev macro block index fail", K(ret), K(key));
       }
+    } else {
+      STORAGE_LOG(DEBUG, "backup macro block reuse", K(macro_index));
     }
   }
   return ret;
@@ -3368,6 +3317,7 @@ int ObBackupCopyPhysicalTask::fetch_backup_macro_block_arg(const share::ObPhysic
   ObTableHandle tmp_handle;
   ObSSTable* sstable = NULL;
   ObFullMacroBlockMeta full_meta;
+  ObBackupTableMacroIndex prev_index;
 
   if (!table_key.is_valid() || macro_idx < 0) {
     ret = OB_INVALID_ARGUMENT;
@@ -3410,10 +3360,20 @@ int ObBackupCopyPhysicalTask::fetch_backup_macro_block_arg(const share::ObPhysic
               STORAGE_LOG(WARN, "phaysical restore macro index should not be NULL", K(ret), KP(macro_index));
             } else if (OB_FAIL(backup_pg_ctx_->check_table_exist(table_key, *macro_index, is_exist))) {
               STORAGE_LOG(WARN, "failed to check table exist", K(ret), K(macro_arg));
-            } else if (!is_exist) {
+            } else if (!is_exist || full_meta.meta_->data_version_ > backup_arg.prev_data_version_) {
               macro_arg.need_copy_ = true;
+            } else if (OB_FAIL(backup_pg_ctx_->fetch_prev_macro_index(*macro_index, macro_arg, prev_index))) {
+              if (OB_HASH_NOT_EXIST == ret) {
+                // not in any previous backup set, e.g. the sstable was rebuilt from another replica
+                ret = OB_SUCCESS;
+                macro_arg.need_copy_ = true;
+              } else {
+                STORAGE_LOG(WARN, "failed to fetch prev macro index", K(ret), K(macro_arg));
+              }
             } else {
-              macro_arg.need_copy_ = full_meta.meta_->data_version_ > backup_arg.prev_data_version_;
+              // indexes written by older versions have no checksum, trust the logic id as before
+              macro_arg.need_copy_ =
+                  0 != prev_index.data_checksum_ && prev_index.data_checksum_ != full_meta.meta_->data_checksum_;
             }
             break;
           }
@@ -3757,6 +3717,7 @@ int ObBackupCopyPhysicalTask::reuse_block_index(
           cur_index.sub_task_id_ = prev_index.sub_task_id_;
           cur_index.offset_ = prev_index.offset_;
           cur_index.data_length_ = prev_index.data_length_;
+          cur_index.data_checksum_ = prev_index.data_checksum_;
           ++reuse_count;
         }
       }
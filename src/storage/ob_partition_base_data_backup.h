@@ -421,16 +421,6 @@ public:
     int64_t block_count_;
   };
 
-  struct MacroIndexMergePoint final {
-    MacroIndexMergePoint();
-    void reset();
-    bool is_valid() const;
-    TO_STRING_KV(K_(table_id), K_(sstable_idx), KP_(macro_index_array));
-    uint64_t table_id_;
-    int64_t sstable_idx_;
-    const ObArray<ObBackupTableMacroIndex>* macro_index_array_;
-  };
-
   struct MacroIndexRetryPoint final {
     MacroIndexRetryPoint();
     void reset();
@@ -475,7 +465,7 @@ public:
     return backup_data_type_.type_;
   }
 
-  TO_STRING_KV(K_(macro_block_count), K_(base_task_id), K_(retry_cnt), K_(task_turn), K_(index_merge_point), K_(result),
+  TO_STRING_KV(K_(macro_block_count), K_(base_task_id), K_(retry_cnt), K_(task_turn), K_(result),
       K_(pg_key), K_(table_keys), "task_count", tasks_.count(), K_(macro_index_appender));
   common::ObInOutBandwidthThrottle* bandwidth_throttle_;
   ObArray<ObITable::TableKey> table_keys_;
@@ -499,7 +489,6 @@ private:
 private:
   common::ObThreadCond cond_;
   volatile int64_t task_turn_;
-  MacroIndexMergePoint index_merge_point_;
   common::SpinRWLock lock_;
   int32_t result_;
   common::ObPGKey pg_key_;
@@ -15,6 +15,7 @@
 #include "lib/time/ob_time_utility.h"
 #include "lib/stat/ob_session_stat.h"
 #include "share/stat/ob_stat_manager.h"
+#include "share/stat/ob_histogram_builder.h"
 #include "share/schema/ob_multi_version_schema_service.h"
 #include "share/ob_index_task_table_operator.h"
 #include "observer/ob_sstable_checksum_updater.h"
@@ -176,6 +177,7 @@ ObSSTableMergeContext::ObSSTableMergeContext()
       bloom_filter_block_ctx_(nullptr),
       sstable_merge_info_(),
       column_stats_(nullptr),
+      histogram_builders_(nullptr),
       allocator_(ObModIds::OB_CS_MERGER, OB_MALLOC_MIDDLE_BLOCK_SIZE),
       finish_count_(0),
       concurrent_cnt_(0),
@@ -216,7 +218,7 @@ void ObSSTableMergeContext::destroy()
 }
 
 int ObSSTableMergeContext::init(const int64_t concurrent_cnt, const bool has_lob, ObIArray<ObColumnStat*>* column_stats,
-    const bool merge_complement)
+    ObIArray<ObHistogramBuilder*>* histogram_builders, const bool merge_complement)
 {
   int ret = OB_SUCCESS;
 
@@ -239,6 +241,7 @@ int ObSSTableMergeContext::init(const int64_t concurrent_cnt, const bool has_lob
     }
     bloom_filter_block_ctx_ = NULL;
     column_stats_ = column_stats;
+    histogram_builders_ = histogram_builders;
     concurrent_cnt_ = concurrent_cnt;
     finish_count_ = 0;
     merge_complement_ = merge_complement;
@@ -301,6 +304,32 @@ int ObSSTableMergeContext::add_column_stats(const common::ObIArray<common::ObCol
   return ret;
 }
 
+int ObSSTableMergeContext::add_histogram_builders(const common::ObIArray<ObHistogramBuilder*>& histogram_builders)
+{
+  int ret = OB_SUCCESS;
+  ObSpinLockGuard guard(lock_);
+  if (!is_inited_) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not inited", K(ret));
+  } else if (OB_ISNULL(histogram_builders_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("The histogram builders is null, ", K(ret));
+  } else if (OB_UNLIKELY(histogram_builders_->count() != histogram_builders.count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Not equal column count, ", K(ret), K(histogram_builders_->count()), K(histogram_builders.count()));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < histogram_builders_->count(); ++i) {
+      if (OB_ISNULL(histogram_builders_->at(i)) || OB_ISNULL(histogram_builders.at(i))) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("The histogram builder is null, ", K(ret), K(i));
+      } else if (OB_FAIL(histogram_builders_->at(i)->merge(*histogram_builders.at(i)))) {
+        LOG_WARN("Fail to merge histogram builder, ", K(i), K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObSSTableMergeContext::add_lob_macro_blocks(const int64_t idx, blocksstable::ObMacroBlocksWriteCtx* blocks_ctx)
 {
   int ret = OB_SUCCESS;
@@ -538,6 +567,21 @@ int ObSSTableMergePrepareTask::init_estimate(storage::ObSSTableMergeCtx& ctx)
         column_stat = NULL;
       }
     }
+    // incremental merge only samples the rewritten macro blocks, histograms need all rows
+    const bool need_histogram = ctx.is_full_merge_ && GCONF._merge_histogram_bucket_count > 0;
+    ObHistogramBuilder* builder = NULL;
+    for (int64_t i = 0; OB_SUCCESS == tmp_ret && need_histogram && i < column_ids.count(); ++i) {
+      if (OB_ISNULL(buf = ctx.allocator_.alloc(sizeof(ObHistogramBuilder)))) {
+        tmp_ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("fail to allocate memory for histogram builder", K(tmp_ret));
+      } else if (FALSE_IT(builder = new (buf) ObHistogramBuilder())) {
+      } else if (OB_SUCCESS != (tmp_ret = ctx.histogram_builders_.push_back(builder))) {
+        LOG_WARN("fail to push back histogram builder", K(tmp_ret));
+        builder->~ObHistogramBuilder();
+      }
+      buf = NULL;
+      builder = NULL;
+    }
     if (OB_FAIL(tmp_ret)) {
       ctx.stat_sampling_ratio_ = 0;
       LOG_WARN("failed to init_estimate, skip update estimator", K(ctx.stat_sampling_ratio_), K(ret), K(tmp_ret));
@@ -576,6 +620,7 @@ ObSSTableMergeCtx::ObSSTableMergeCtx()
       checksum_method_(0),
       mv_dep_tables_handle_(),
       column_stats_(OB_MALLOC_NORMAL_BLOCK_SIZE, allocator_),
+      histogram_builders_(OB_MALLOC_NORMAL_BLOCK_SIZE, allocator_),
       merged_table_handle_(),
       merged_complement_minor_table_handle_(),
       allocator_(ObModIds::OB_CS_MERGER),
@@ -599,7 +644,14 @@ ObSSTableMergeCtx::ObSSTableMergeCtx()
 {}
 
 ObSSTableMergeCtx::~ObSSTableMergeCtx()
-{}
+{
+  for (int64_t i = 0; i < histogram_builders_.count(); ++i) {
+    if (NULL != histogram_builders_.at(i)) {
+      histogram_builders_.at(i)->~ObHistogramBuilder();
+    }
+  }
+  histogram_builders_.reset();
+}
 
 bool ObSSTableMergeCtx::is_valid() const
 {
@@ -1434,6 +1486,25 @@ int ObSSTableMergeFinishTask::get_merged_sstable_(const ObITable::TableType& typ
           OB_FAIL(ObPartitionStorage::update_estimator(
               ctx.table_schema_, ctx.is_full_merge_, ctx.column_stats_, sstable, pkey))) {
         STORAGE_LOG(WARN, "failed to update estimator", K(ret), K(pkey));
+      } else if (ctx.stat_sampling_ratio_ > 0 && !ctx.histogram_builders_.empty()) {
+        int tmp_ret = OB_SUCCESS;
+        ObRole role = INVALID_ROLE;
+        const int64_t bucket_cnt = GCONF._merge_histogram_bucket_count;
+        // every replica merges the same data, only the leader publishes the histograms
+        if (OB_ISNULL(ctx.pg_guard_.get_partition_group())) {
+          tmp_ret = OB_ERR_UNEXPECTED;
+          STORAGE_LOG(WARN, "partition group is null", K(tmp_ret), K(pkey));
+        } else if (OB_SUCCESS != (tmp_ret = ctx.pg_guard_.get_partition_group()->get_role(role))) {
+          STORAGE_LOG(WARN, "failed to get role", K(tmp_ret), K(pkey));
+        } else if (!is_strong_leader(role)) {
+          // followers skip histograms
+        } else if (OB_SUCCESS != (tmp_ret = ObPartitionStorage::update_histograms(ctx.column_stats_,
+                                      ctx.histogram_builders_,
+                                      bucket_cnt,
+                                      ctx.sstable_version_range_.snapshot_version_,
+                                      pkey))) {
+          STORAGE_LOG(WARN, "failed to update histograms", K(tmp_ret), K(pkey));
+        }
       }
     }
   }
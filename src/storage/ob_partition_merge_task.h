@@ -28,6 +28,7 @@ namespace oceanbase {
 
 namespace common {
 class ObStoreRowkey;
+class ObHistogramBuilder;
 }
 
 namespace storage {
@@ -63,11 +64,12 @@ public:
   virtual ~ObSSTableMergeContext();
 
   int init(const int64_t array_count, const bool has_lob, common::ObIArray<common::ObColumnStat*>* column_stats,
-      const bool merge_complement);
+      common::ObIArray<common::ObHistogramBuilder*>* histogram_builders, const bool merge_complement);
   int add_macro_blocks(const int64_t idx, blocksstable::ObMacroBlocksWriteCtx* blocks_ctx,
       blocksstable::ObMacroBlocksWriteCtx* lob_blocks_ctx, const ObSSTableMergeInfo& sstable_merge_info);
   int add_bloom_filter(blocksstable::ObMacroBlocksWriteCtx& bloom_filter_blocks_ctx);
   int add_column_stats(const common::ObIArray<common::ObColumnStat*>& column_stats);
+  int add_histogram_builders(const common::ObIArray<common::ObHistogramBuilder*>& histogram_builders);
   int create_sstable(storage::ObCreateSSTableParamWithTable& param, storage::ObIPartitionGroupGuard& pg_guard,
       ObTableHandle& table_handle);
   int create_sstables(ObIArray<storage::ObCreateSSTableParamWithTable>& params,
@@ -105,6 +107,7 @@ private:
   blocksstable::ObMacroBlocksWriteCtx* bloom_filter_block_ctx_;
   ObSSTableMergeInfo sstable_merge_info_;
   common::ObIArray<common::ObColumnStat*>* column_stats_;
+  common::ObIArray<common::ObHistogramBuilder*>* histogram_builders_;
   common::ObArenaAllocator allocator_;
   int64_t finish_count_;
   int64_t concurrent_cnt_;
@@ -228,6 +231,8 @@ struct ObSSTableMergeCtx {
 
   // 6. inited in ObSSTableMergePrepareTask::init_estimate
   common::ObArray<common::ObColumnStat*, ObIAllocator&> column_stats_;
+  // only for full major merge, one builder per column of column_stats_
+  common::ObArray<common::ObHistogramBuilder*, ObIAllocator&> histogram_builders_;
 
   // 7. filled in ObSSTableMergeFinishTask::update_partition_store
   storage::ObTableHandle merged_table_handle_;
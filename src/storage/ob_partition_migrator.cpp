@@ -10624,7 +10624,13 @@ int ObITableTaskGeneratorTask::build_sub_physical_task(
     ctx.task_count_ = 0;
     LOG_INFO("no macro block need copy", K(ret));
   } else {
-    const int64_t max_macro_block_count_per_task = ObMigratePrepareTask::MAX_MACRO_BLOCK_COUNT_PER_TASK;
+    // copy tasks of one sstable run concurrently in the dag, so split the list into at least
+    // _migrate_block_fetch_stream_count streams, all of them share the bandwidth throttle of the server
+    const int64_t stream_count = std::max(1L, static_cast<int64_t>(GCONF._migrate_block_fetch_stream_count));
+    const int64_t block_count_per_stream = (macro_block_list.count() + stream_count - 1) / stream_count;
+    const int64_t max_macro_block_count_per_task =
+        std::min(ObMigratePrepareTask::MAX_MACRO_BLOCK_COUNT_PER_TASK,
+            std::max(ObMigratePrepareTask::MIN_MACRO_BLOCK_COUNT_PER_TASK, block_count_per_stream));
     ctx.task_count_ = macro_block_list.count() / max_macro_block_count_per_task;
     if (macro_block_list.count() % max_macro_block_count_per_task > 0) {
       ++ctx.task_count_;
@@ -10640,6 +10646,7 @@ int ObITableTaskGeneratorTask::build_sub_physical_task(
     for (int64_t task_idx = 0; OB_SUCC(ret) && task_idx < ctx.task_count_; ++task_idx) {
       ObMigratePhysicalSSTableCtx::SubTask &sub_task = ctx.tasks_[task_idx];
       sub_task.pkey_ = ctx.sstable_info_.src_table_key_.pkey_;
+      sub_task.macro_block_idx_ = task_idx * max_macro_block_count_per_task;
       sub_task.block_count_ = std::min(
           max_macro_block_count_per_task, macro_block_list.count() - task_idx * max_macro_block_count_per_task);
       if (OB_ISNULL(buf = ctx.allocator_.alloc(sizeof(ObMigrateMacroBlockInfo) * sub_task.block_count_))) {
@@ -11570,7 +11577,11 @@ int ObMigrateFinishLogicTask::process()
 }
 
 ObMigratePhysicalSSTableCtx::SubTask::SubTask()
-    : block_info_(NULL), block_count_(0), pkey_(), allocator_(ObModIds::OB_PARTITION_MIGRATOR)
+    : block_info_(NULL),
+      block_count_(0),
+      macro_block_idx_(0),
+      pkey_(),
+      allocator_(ObModIds::OB_PARTITION_MIGRATOR)
 {}
 
 ObMigratePhysicalSSTableCtx::SubTask::~SubTask()
@@ -11955,8 +11966,7 @@ int ObMigrateCopyPhysicalTask::process()
         }
         // todo ():backup macro reuse
       } else {
-        const int64_t max_block_count_per_task = ObMigratePrepareTask::MAX_MACRO_BLOCK_COUNT_PER_TASK;
-        arg_info.fetch_arg_.macro_block_index_ = max_block_count_per_task * task_idx_ + i;
+        arg_info.fetch_arg_.macro_block_index_ = sub_task_->macro_block_idx_ + i;
         arg_info.fetch_arg_.data_version_ = sub_task_->block_info_[i].pair_.data_version_;
         arg_info.fetch_arg_.data_seq_ = sub_task_->block_info_[i].pair_.data_seq_;
         if (OB_FAIL(list.push_back(arg_info))) {
@@ -12951,7 +12961,7 @@ int64_t ObMigratePhysicalSSTableCtx::SubTask::to_string(char *buf, const int64_t
     // do nothing
   } else {
     J_OBJ_START();
-    J_KV(KP(this), K_(block_count));
+    J_KV(KP(this), K_(block_count), K_(macro_block_idx));
     J_COMMA();
     J_ARRAY_START();
     for (int64_t i = 0; i < block_count_; ++i) {
@@ -811,6 +811,8 @@ class ObMigratePrepareTask : public share::ObITask {
 public:
   static const int64_t MAX_LOGIC_TASK_COUNT_PER_SSTABLE = 64;
   static const int64_t MAX_MACRO_BLOCK_COUNT_PER_TASK = 128;
+  // small sstables are not split into streams thinner than this
+  static const int64_t MIN_MACRO_BLOCK_COUNT_PER_TASK = 16;
   static const int64_t OB_GET_SNAPSHOT_SCHEMA_VERSION_TIMEOUT = 30 * 1000 * 1000;  // 30s
   static const int64_t OB_GET_SNAPSHOT_SCHEMA_INTERVAL = 1 * 1000 * 1000;          // 1s
   static const int64_t OB_FETCH_TABLE_INFO_TIMEOUT = 30 * 1000 * 1000;             // 30s
@@ -1023,6 +1025,7 @@ struct ObMigratePhysicalSSTableCtx {
   struct SubTask {
     ObMigrateMacroBlockInfo* block_info_;
     int64_t block_count_;
+    int64_t macro_block_idx_;  // index of the first block in the macro block list of sstable
     common::ObPartitionKey pkey_;
     common::ObArenaAllocator allocator_;
 
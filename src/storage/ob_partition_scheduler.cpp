@@ -33,6 +33,7 @@
 #include "observer/ob_server.h"
 #include "storage/ob_file_system_util.h"
 #include "storage/ob_pg_storage.h"
+#include "storage/ob_table_store_stat_mgr.h"
 #include <algorithm>
 
 namespace oceanbase {
@@ -45,6 +46,7 @@ using namespace share::schema;
 using namespace share;
 using namespace memtable;
 static const int64_t TENANT_BUCKET_NUM = 128;
+static const int64_t PARTITION_READ_CNT_BUCKET_NUM = 10000;
 /*
  * -----------------------------------------------ObBloomfilterBuildTask---------------------------------------------------
  */
@@ -697,6 +699,9 @@ int ObPartitionScheduler::init(
     LOG_WARN("failed to create tenant_snapshot_map_", K(ret));
   } else if (OB_FAIL(minor_merge_his_map_.create(TENANT_BUCKET_NUM, common::ObModIds::OB_PARTITION_SCHEDULER))) {
     LOG_WARN("failed to create minor_merge_his_map_", K(ret));
+  } else if (OB_FAIL(bf_miss_cnt_map_.create(
+                 PARTITION_READ_CNT_BUCKET_NUM, common::ObModIds::OB_PARTITION_SCHEDULER))) {
+    LOG_WARN("failed to create bf_miss_cnt_map_", K(ret));
   } else if (OB_FAIL(TG_START(lib::TGDefIDs::MinorScan))) {
     LOG_WARN("Fail to init timer, ", K(ret));
   } else if (OB_FAIL(min_sstable_schema_version_map_.create(TENANT_BUCKET_NUM, "min_sch_version"))) {
@@ -885,6 +890,7 @@ int ObPartitionScheduler::schedule_minor_merge_all()
     if (OB_FAIL(sort_for_minor_merge(merge_priority_infos, partitions))) {
       STORAGE_LOG(WARN, "failed to sort for minor merge", K(ret));
     }
+    // mini merges release frozen memtables, keep the memtable priority order
     for (int64_t i = 0; OB_SUCC(ret) && !is_stop_ && i < merge_priority_infos.count(); i++) {
       partition = merge_priority_infos.at(i).partition_;
       if (OB_UNLIKELY(NULL == partition)) {
@@ -901,25 +907,26 @@ int ObPartitionScheduler::schedule_minor_merge_all()
               break;
             }
           }
-          if (OB_SUCCESS != (tmp_ret = schedule_pg(MINI_MINOR_MERGE, *partition, invalid_version, is_merged))) {
-            if (OB_EAGAIN != tmp_ret && OB_SIZE_OVERFLOW != tmp_ret) {
-              LOG_WARN("Fail to add merge task, ", K(pkey), K(tmp_ret));
-            } else if (OB_SIZE_OVERFLOW == tmp_ret) {
-              break;
-            }
-          }
-          if (OB_SUCCESS != (tmp_ret = schedule_pg(HISTORY_MINI_MINOR_MERGE, *partition, invalid_version, is_merged))) {
-            if (OB_EAGAIN != tmp_ret && OB_SIZE_OVERFLOW != tmp_ret) {
-              LOG_WARN("Fail to add merge task, ", K(pkey), K(tmp_ret));
-            } else if (OB_SIZE_OVERFLOW == tmp_ret) {
-              break;
-            }
-          }
         } else {
           LOG_DEBUG("skip partition no need minor merge", K(state), K(pkey));
         }
       }
     }
+
+    // minor merges go to the partitions whose reads probe the most minor sstables first
+    common::ObArray<ObMinorMergeReadAmpInfo> read_amp_infos;
+    if (OB_SUCC(ret) && OB_FAIL(sort_for_read_amplification(merge_priority_infos, read_amp_infos))) {
+      STORAGE_LOG(WARN, "failed to sort for read amplification", K(ret));
+    }
+    bool is_overflow = false;
+    for (int64_t i = 0; OB_SUCC(ret) && !is_stop_ && !is_overflow && i < read_amp_infos.count(); i++) {
+      if (OB_ISNULL(partition = read_amp_infos.at(i).partition_)) {
+        ret = OB_ERR_UNEXPECTED;
+        STORAGE_LOG(WARN, "get partition failed", K(ret));
+      } else if (OB_FAIL(schedule_minor_merge_pg(*partition, is_overflow))) {
+        STORAGE_LOG(WARN, "failed to schedule minor merge", K(ret), K(read_amp_infos.at(i)));
+      }
+    }
   }
 
   cost_ts = ObTimeUtility::current_time() - cost_ts;
@@ -959,6 +966,172 @@ int ObPartitionScheduler::sort_for_minor_merge(
   return ret;
 }
 
+int ObPartitionScheduler::schedule_minor_merge_pg(ObIPartitionGroup& pg, bool& is_overflow)
+{
+  int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
+  bool is_merged = false;
+  ObVersion invalid_version = ObVersion::MIN_VERSION;
+  const ObMergeType merge_types[] = {MINI_MINOR_MERGE, HISTORY_MINI_MINOR_MERGE};
+  ObPartitionState state = pg.get_partition_state();
+  const ObPartitionKey& pkey = pg.get_partition_key();
+  is_overflow = false;
+  if (is_leader_state(state) || is_follower_state(state)) {
+    for (int64_t i = 0; !is_overflow && i < ARRAYSIZEOF(merge_types); ++i) {
+      if (OB_SUCCESS != (tmp_ret = schedule_pg(merge_types[i], pg, invalid_version, is_merged))) {
+        if (OB_EAGAIN != tmp_ret && OB_SIZE_OVERFLOW != tmp_ret) {
+          LOG_WARN("Fail to add merge task, ", K(pkey), K(tmp_ret));
+        } else if (OB_SIZE_OVERFLOW == tmp_ret) {
+          is_overflow = true;
+        }
+      }
+    }
+  } else {
+    LOG_DEBUG("skip partition no need minor merge", K(state), K(pkey));
+  }
+  return ret;
+}
+
+int64_t ObMinorMergeReadAmpInfo::get_bf_miss_cnt(const ObTableStoreStat& stat)
+{
+  const int64_t bf_miss_cnt = stat.bf_access_cnt_ - stat.bf_filter_cnt_;
+  return bf_miss_cnt > 0 ? bf_miss_cnt : 0;
+}
+
+int64_t ObMinorMergeReadAmpInfo::get_bf_miss_delta(const int64_t cur_cnt, const int64_t last_cnt)
+{
+  return cur_cnt >= last_cnt ? cur_cnt - last_cnt : cur_cnt;
+}
+
+void ObMinorMergeReadAmpInfo::calc_score()
+{
+  score_ = 0;
+  if (minor_table_cnt_ > 1) {
+    // a probe visits every minor sstable the bloom filter lets through, a minor merge leaves only one of them
+    const double saved_probe_cnt = static_cast<double>(bf_miss_cnt_) * static_cast<double>(minor_table_cnt_ - 1) /
+                                   static_cast<double>(minor_table_cnt_);
+    const double rewrite_mb = std::max(1.0, static_cast<double>(minor_table_size_) / (1 << 20));
+    score_ = saved_probe_cnt / rewrite_mb;
+  }
+}
+
+int ObPartitionScheduler::sort_for_read_amplification(
+    const ObIArray<ObMergePriorityInfo>& merge_priority_infos, ObArray<ObMinorMergeReadAmpInfo>& read_amp_infos)
+{
+  int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
+  const bool use_read_amp = GCONF._minor_merge_read_amplification_priority;
+  ObArray<std::pair<ObPartitionKey, int64_t>> bf_miss_cnts;
+  ObMinorMergeReadAmpInfo info;
+  if (OB_FAIL(read_amp_infos.reserve(merge_priority_infos.count()))) {
+    STORAGE_LOG(WARN, "failed to reserve for read_amp_infos", K(ret), K(merge_priority_infos.count()));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && !is_stop_ && i < merge_priority_infos.count(); i++) {
+    info = ObMinorMergeReadAmpInfo();
+    info.partition_ = merge_priority_infos.at(i).partition_;
+    info.priority_idx_ = i;
+    if (OB_ISNULL(info.partition_)) {
+      ret = OB_ERR_UNEXPECTED;
+      STORAGE_LOG(WARN, "get partition failed", K(ret));
+    } else if (use_read_amp &&
+               OB_SUCCESS != (tmp_ret = get_read_amplification_info(*info.partition_, bf_miss_cnts, info))) {
+      // fall back to the memtable priority order for this partition
+      STORAGE_LOG(WARN, "failed to get read amplification info", K(tmp_ret), K(info));
+      info.score_ = 0;
+    }
+    if (OB_SUCC(ret) && OB_FAIL(read_amp_infos.push_back(info))) {
+      STORAGE_LOG(WARN, "failed to push back read amp info", K(ret));
+    }
+  }
+
+  if (OB_SUCC(ret) && use_read_amp) {
+    std::sort(read_amp_infos.begin(), read_amp_infos.end(), ObMinorMergeReadAmpCompare());
+    if (read_amp_infos.count() > 0 && read_amp_infos.at(0).score_ > 0) {
+      STORAGE_LOG(INFO, "top read amplification partition", "info", read_amp_infos.at(0));
+    }
+    // remember the accumulated counts, the next scan only looks at reads after this one
+    bf_miss_cnt_map_.clear();
+    tmp_ret = OB_SUCCESS;
+    for (int64_t i = 0; OB_SUCCESS == tmp_ret && i < bf_miss_cnts.count(); ++i) {
+      const ObPartitionKey& pkey = bf_miss_cnts.at(i).first;
+      if (OB_SUCCESS != (tmp_ret = bf_miss_cnt_map_.set_refactored(pkey, bf_miss_cnts.at(i).second))) {
+        STORAGE_LOG(WARN, "failed to set bf miss cnt", K(tmp_ret), K(pkey));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObPartitionScheduler::get_read_amplification_info(ObIPartitionGroup& pg,
+    ObIArray<std::pair<ObPartitionKey, int64_t>>& bf_miss_cnts, ObMinorMergeReadAmpInfo& info)
+{
+  int ret = OB_SUCCESS;
+  ObPartitionArray pkeys;
+  if (OB_FAIL(pg.get_all_pg_partition_keys(pkeys))) {
+    LOG_WARN("failed to get all pg partition keys", K(ret), "pg_key", pg.get_partition_key());
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < pkeys.count(); ++i) {
+    const ObPartitionKey& pkey = pkeys.at(i);
+    ObTableStoreStat stat;
+    int64_t bf_miss_cnt = 0;
+    int64_t last_bf_miss_cnt = 0;
+    if (OB_FAIL(ObTableStoreStatMgr::get_instance().get_table_store_stat(
+            ObTableStoreStatKey(pkey.get_table_id(), pkey.get_partition_id()), stat))) {
+      if (OB_HASH_NOT_EXIST == ret) {
+        // not read recently
+        ret = OB_SUCCESS;
+      } else {
+        LOG_WARN("failed to get table store stat", K(ret), K(pkey));
+      }
+    } else if (FALSE_IT(bf_miss_cnt = ObMinorMergeReadAmpInfo::get_bf_miss_cnt(stat))) {
+    } else if (OB_FAIL(bf_miss_cnts.push_back(std::make_pair(pkey, bf_miss_cnt)))) {
+      LOG_WARN("failed to push back bf miss cnt", K(ret), K(pkey));
+    } else if (OB_FAIL(bf_miss_cnt_map_.get_refactored(pkey, last_bf_miss_cnt))) {
+      if (OB_HASH_NOT_EXIST == ret) {
+        // first seen, the accumulated count may cover a long time
+        ret = OB_SUCCESS;
+      } else {
+        LOG_WARN("failed to get last bf miss cnt", K(ret), K(pkey));
+      }
+    } else {
+      info.bf_miss_cnt_ += ObMinorMergeReadAmpInfo::get_bf_miss_delta(bf_miss_cnt, last_bf_miss_cnt);
+    }
+  }
+
+  // only partitions being read pay for the table stores scan
+  for (int64_t i = 0; OB_SUCC(ret) && info.bf_miss_cnt_ > 0 && i < pkeys.count(); ++i) {
+    const ObPartitionKey& pkey = pkeys.at(i);
+    ObPGPartitionGuard guard;
+    ObPGPartition* pg_partition = nullptr;
+    ObPartitionStorage* storage = nullptr;
+    ObTablesHandle tables_handle;
+    bool is_ready_for_read = false;
+    if (OB_FAIL(pg.get_pg_partition(pkey, guard))) {
+      LOG_WARN("failed to get pg partition", K(ret), K(pkey));
+    } else if (OB_ISNULL(pg_partition = guard.get_pg_partition()) ||
+               OB_ISNULL(storage = static_cast<ObPartitionStorage*>(pg_partition->get_storage()))) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("pg partition or storage is null", K(ret), K(pkey), KP(pg_partition));
+    } else if (OB_FAIL(storage->get_partition_store().get_effective_tables(
+                   pkey.get_table_id(), tables_handle, is_ready_for_read))) {
+      LOG_WARN("failed to get effective tables", K(ret), K(pkey));
+    } else {
+      for (int64_t j = 0; j < tables_handle.get_count(); ++j) {
+        ObITable* table = tables_handle.get_table(j);
+        if (OB_NOT_NULL(table) && table->is_minor_sstable()) {
+          ++info.minor_table_cnt_;
+          info.minor_table_size_ += static_cast<ObSSTable*>(table)->get_occupy_size();
+        }
+      }
+    }
+  }
+
+  if (OB_SUCC(ret)) {
+    info.calc_score();
+  }
+  return ret;
+}
+
 int ObPartitionScheduler::schedule_build_bloomfilter(
     const uint64_t table_id, const MacroBlockId macro_id, const int64_t prefix_len, const ObITable::TableKey& table_key)
 {
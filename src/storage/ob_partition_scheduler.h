@@ -27,6 +27,7 @@ namespace storage {
 class ObBuildIndexDag;
 class ObSSTableMergeDag;
 class ObWriteCheckpointDag;
+struct ObTableStoreStat;
 }  // namespace storage
 namespace storage {
 class ObBloomFilterLoadTask : public common::IObDedupTask {
@@ -163,6 +164,38 @@ struct ObMergePriorityCompare {
   }
 };
 
+// read cost a minor merge of the partition group may save, collected in each minor scan
+struct ObMinorMergeReadAmpInfo {
+  ObMinorMergeReadAmpInfo()
+      : partition_(nullptr),
+        priority_idx_(0),
+        bf_miss_cnt_(0),
+        minor_table_cnt_(0),
+        minor_table_size_(0),
+        score_(0)
+  {}
+  // sstable probes the bloom filter did not skip, each of them reads the sstable
+  static int64_t get_bf_miss_cnt(const ObTableStoreStat& stat);
+  // the stat restarts from zero after it is evicted
+  static int64_t get_bf_miss_delta(const int64_t cur_cnt, const int64_t last_cnt);
+  void calc_score();
+  TO_STRING_KV(KP_(partition), K_(priority_idx), K_(bf_miss_cnt), K_(minor_table_cnt), K_(minor_table_size),
+      K_(score));
+  ObIPartitionGroup* partition_;
+  int64_t priority_idx_;  // position in the memtable merge priority order
+  int64_t bf_miss_cnt_;   // sstable probes passing the bloom filter since the last minor scan
+  int64_t minor_table_cnt_;
+  int64_t minor_table_size_;
+  double score_;  // saved sstable probes per MB rewritten
+};
+
+struct ObMinorMergeReadAmpCompare {
+  bool operator()(const ObMinorMergeReadAmpInfo& linfo, const ObMinorMergeReadAmpInfo& rinfo) const
+  {
+    return linfo.score_ > rinfo.score_ || (linfo.score_ == rinfo.score_ && linfo.priority_idx_ < rinfo.priority_idx_);
+  }
+};
+
 class ObPartitionScheduler {
   friend ObClearTransTableTask;
 
@@ -308,6 +341,11 @@ private:
   int schedule_minor_merge_all();
   int sort_for_minor_merge(
       common::ObArray<memtable::ObMergePriorityInfo>& merge_priority_infos, ObIPartitionArrayGuard& partitions);
+  int sort_for_read_amplification(const common::ObIArray<memtable::ObMergePriorityInfo>& merge_priority_infos,
+      common::ObArray<ObMinorMergeReadAmpInfo>& read_amp_infos);
+  int get_read_amplification_info(ObIPartitionGroup& pg,
+      common::ObIArray<std::pair<common::ObPartitionKey, int64_t>>& bf_miss_cnts, ObMinorMergeReadAmpInfo& info);
+  int schedule_minor_merge_pg(ObIPartitionGroup& pg, bool& is_overflow);
   int merge_all();
   int check_all();
   int32_t get_max_merge_thread_cnt();
@@ -354,6 +392,8 @@ private:
   typedef common::hash::ObHashMap<uint64_t, ObMinorMergeHistory*, common::hash::NoPthreadDefendMode>
       MinorMergeHistoryMap;
   typedef common::hash::ObHashMap<uint64_t, int64_t, common::hash::NoPthreadDefendMode> TenantSnapshotMap;
+  typedef common::hash::ObHashMap<common::ObPartitionKey, int64_t, common::hash::NoPthreadDefendMode>
+      PartitionReadCntMap;
   common::ObVersion frozen_version_;
   common::ObVersion merged_version_;  // the merged major version of the local server, may be not accurate after reboot
   common::ObDedupQueue queue_;
@@ -380,6 +420,8 @@ private:
   MinorMergeHistoryMap minor_merge_his_map_;
   TenantSnapshotMap tenant_snapshot_map_;
   TenantSnapshotMap current_tenant_snapshot_map_;
+  // accumulated bloom filter misses of each partition seen by the last minor scan
+  PartitionReadCntMap bf_miss_cnt_map_;
   bool is_stop_;
   ObClearTransTableTask clear_unused_trans_status_task_;
   ObVersion report_version_;
@@ -72,6 +72,8 @@
 #include "share/partition_table/ob_partition_table_operator.h"
 #include "ob_partition_service.h"
 #include "storage/ob_sstable_merge_info_mgr.h"
+#include "share/stat/ob_histogram_builder.h"
+#include "share/stat/ob_opt_stat_manager.h"
 #include "share/ob_task_define.h"
 #include <libgen.h>
 #include <sys/resource.h>
@@ -4422,6 +4424,68 @@ int ObPartitionStorage::update_estimator(const ObTableSchema* base_schema, const
   return ret;
 }
 
+int ObPartitionStorage::update_histograms(const ObIArray<ObColumnStat*>& column_stats,
+    const ObIArray<ObHistogramBuilder*>& histogram_builders, const int64_t bucket_cnt,
+    const int64_t snapshot_version, const ObPartitionKey& pkey)
+{
+  int ret = OB_SUCCESS;
+  ObArenaAllocator allocator(ObModIds::OB_CS_MERGER);
+  ObArray<ObOptColumnStat*> opt_stats;
+  ObOptColumnStat* opt_stat = NULL;
+  void* buf = NULL;
+
+  if (OB_UNLIKELY(bucket_cnt <= 0 || column_stats.count() != histogram_builders.count() || snapshot_version <= 0 ||
+                  !pkey.is_valid())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(bucket_cnt), K(column_stats.count()), K(histogram_builders.count()),
+        K(snapshot_version), K(pkey));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < column_stats.count(); ++i) {
+    const ObColumnStat* column_stat = column_stats.at(i);
+    ObHistogramBuilder* builder = histogram_builders.at(i);
+    if (OB_ISNULL(column_stat) || OB_ISNULL(builder)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("column stat or histogram builder is null", K(ret), K(i), KP(column_stat), KP(builder));
+    } else if (0 == builder->get_sample_count()) {
+      // all values are null or too large, no histogram
+    } else if (OB_ISNULL(buf = allocator.alloc(sizeof(ObOptColumnStat)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("fail to allocate memory for ObOptColumnStat", K(ret));
+    } else if (OB_ISNULL(opt_stat = new (buf) ObOptColumnStat(allocator)) || OB_UNLIKELY(!opt_stat->is_writable())) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("fail to allocate object buffer of ObOptColumnStat", K(ret));
+    } else {
+      opt_stat->set_table_id(pkey.get_table_id());
+      opt_stat->set_partition_id(pkey.get_partition_id());
+      opt_stat->set_column_id(column_stat->get_column_id());
+      opt_stat->set_stat_level(StatLevel::PARTITION_LEVEL);
+      opt_stat->set_num_distinct(column_stat->get_num_distinct());
+      opt_stat->set_num_null(column_stat->get_num_null());
+      opt_stat->set_merge_built(true);
+      if (OB_FAIL(opt_stat->store_min_value(column_stat->get_min_value()))) {
+        LOG_WARN("fail to store min value", K(ret));
+      } else if (OB_FAIL(opt_stat->store_max_value(column_stat->get_max_value()))) {
+        LOG_WARN("fail to store max value", K(ret));
+      } else if (OB_FAIL(builder->build(bucket_cnt, column_stat->get_num_distinct(), *opt_stat))) {
+        LOG_WARN("fail to build histogram", K(ret), K(i), K(*builder));
+      } else if (OB_FAIL(opt_stats.push_back(opt_stat))) {
+        LOG_WARN("fail to push back opt column stat", K(ret));
+      }
+    }
+  }
+
+  if (OB_SUCC(ret) && opt_stats.count() > 0) {
+    // the inner sql write is left to the stat manager's task queue, so the merge does not wait for it
+    if (OB_FAIL(ObOptStatManager::get_instance().add_update_histogram_task(opt_stats, snapshot_version))) {
+      LOG_WARN("fail to add update histogram task", K(ret), K(pkey));
+    } else {
+      LOG_INFO("add update histogram task", K(pkey), "column_count", opt_stats.count(), K(bucket_cnt));
+    }
+  }
+
+  return ret;
+}
+
 bool ObPartitionStorage::has_memstore()
 {
   bool bret = false;
@@ -5113,7 +5177,8 @@ int ObPartitionStorage::init_merge_context(storage::ObSSTableMergeCtx& ctx)
     LOG_WARN("Failed to init parallel merge in sstable merge ctx", K(ret));
   } else if (OB_FAIL(ctx.table_schema_->has_lob_column(has_lob, true))) {
     LOG_WARN("Failed to check table has lob column", K(ret));
-  } else if (OB_FAIL(ctx.merge_context_.init(ctx.get_concurrent_cnt(), has_lob, &ctx.column_stats_, false))) {
+  } else if (OB_FAIL(ctx.merge_context_.init(
+                 ctx.get_concurrent_cnt(), has_lob, &ctx.column_stats_, &ctx.histogram_builders_, false))) {
     LOG_WARN("failed to init merge context", K(ret));
   } else if (ctx.param_.is_major_merge()) {
     ObSSTable* old_version_sstable = NULL;
@@ -5141,7 +5206,7 @@ int ObPartitionStorage::init_merge_context(storage::ObSSTableMergeCtx& ctx)
     }
   } else if (ctx.param_.is_mini_merge()) {
     if (OB_FAIL(ctx.merge_context_for_complement_minor_sstable_.init(
-            ctx.get_concurrent_cnt(), has_lob, &ctx.column_stats_, true))) {
+            ctx.get_concurrent_cnt(), has_lob, &ctx.column_stats_, NULL, true))) {
       LOG_WARN("failed to init merge context", K(ret));
     }
   }
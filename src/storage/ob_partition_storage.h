@@ -19,6 +19,7 @@
 namespace oceanbase {
 namespace common {
 class ObRowStore;
+class ObHistogramBuilder;
 }
 namespace share {
 class ObPartitionReplica;
@@ -413,6 +414,11 @@ public:
       const ObPartitionKey& pkey);
   static int update_estimator(const share::schema::ObTableSchema* base_schema, const bool is_full,
       const ObIArray<ObColumnStat*>& column_stats, ObSSTable* sstable, const common::ObPartitionKey& pkey);
+  // column_stats must be finished by update_estimator, one builder per column stat.
+  // the histograms are written asynchronously by ObOptStatManager, call it on the leader only.
+  static int update_histograms(const ObIArray<ObColumnStat*>& column_stats,
+      const ObIArray<common::ObHistogramBuilder*>& histogram_builders, const int64_t bucket_cnt,
+      const int64_t snapshot_version, const common::ObPartitionKey& pkey);
   int create_partition_store(const common::ObReplicaType& replica_type, const int64_t multi_version_start,
       const uint64_t data_table_id, const int64_t create_schema_version, const int64_t create_timestamp,
       ObIPartitionGroup* pg, ObTablesHandle& sstables_handle);
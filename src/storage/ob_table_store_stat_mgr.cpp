@@ -12,6 +12,7 @@
 
 #define USING_LOG_PREFIX STORAGE
 #include "ob_table_store_stat_mgr.h"
+#include <math.h>
 #include "lib/ob_errno.h"
 #include "lib/allocator/ob_mod_define.h"
 #include "share/ob_thread_mgr.h"
@@ -156,6 +157,29 @@ ObTableStoreStat& ObTableStoreStat::operator=(const ObTableStoreStat& other)
   return *this;
 }
 
+int64_t ObTableStoreStat::get_io_cnt() const
+{
+  return block_cache_miss_cnt_;
+}
+
+// The io rate is an exponentially weighted moving average of the ios per second between two samples,
+// a burst shorter than a few minutes barely moves it, so rootserver does not chase short hot spots.
+void ObTableStoreStatNode::sample_load(const int64_t now, const int64_t io_cnt)
+{
+  if (sample_ts_ > 0 && now > sample_ts_) {
+    const double elapsed_us = static_cast<double>(now - sample_ts_);
+    // the stat restarts from zero after it is reset
+    const int64_t delta_cnt = io_cnt >= sample_io_cnt_ ? io_cnt - sample_io_cnt_ : io_cnt;
+    const double cur_rate = static_cast<double>(delta_cnt) * 1000000 / elapsed_us;
+    const double alpha = 1 - exp(-elapsed_us / static_cast<double>(LOAD_DECAY_US));
+    io_rate_ += alpha * (cur_rate - io_rate_);
+  }
+  if (now > sample_ts_) {
+    sample_ts_ = now;
+    sample_io_cnt_ = io_cnt;
+  }
+}
+
 // ------------------ Iterator ------------------ //
 ObTableStoreStatIterator::ObTableStoreStatIterator() : cur_idx_(0), is_opened_(false)
 {}
@@ -225,6 +249,7 @@ ObTableStoreStatMgr::ObTableStoreStatMgr()
       limit_cnt_(0),
       lru_head_(NULL),
       lru_tail_(NULL),
+      last_sample_ts_(0),
       report_cursor_(0),
       pending_cursor_(0),
       report_task_()
@@ -244,6 +269,7 @@ void ObTableStoreStatMgr::destroy()
   pending_cursor_ = 0;
   lru_head_ = NULL;
   lru_tail_ = NULL;
+  last_sample_ts_ = 0;
   cur_cnt_ = 0;
   limit_cnt_ = 0;
   quick_map_.destroy();
@@ -362,6 +388,52 @@ int ObTableStoreStatMgr::get_table_store_stat(const int64_t idx, ObTableStoreSta
   return ret;
 }
 
+int ObTableStoreStatMgr::get_table_store_stat(const ObTableStoreStatKey& key, ObTableStoreStat& stat)
+{
+  int ret = OB_SUCCESS;
+  ObTableStoreStatNode* node = NULL;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("ObTableStoreStatMgr hasn't been initiated", K(ret));
+  } else {
+    SpinRLockGuard guard(lock_);
+    if (OB_FAIL(quick_map_.get_refactored(key, node))) {
+      if (OB_HASH_NOT_EXIST != ret) {
+        LOG_WARN("fail to get node", K(ret), K(key));
+      }
+    } else if (OB_ISNULL(node) || OB_ISNULL(node->stat_)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("node is null", K(ret), K(key));
+    } else {
+      stat = *(node->stat_);
+    }
+  }
+  return ret;
+}
+
+int ObTableStoreStatMgr::get_io_rate(const ObTableStoreStatKey& key, double& io_rate)
+{
+  int ret = OB_SUCCESS;
+  ObTableStoreStatNode* node = NULL;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("ObTableStoreStatMgr hasn't been initiated", K(ret));
+  } else {
+    SpinRLockGuard guard(lock_);
+    if (OB_FAIL(quick_map_.get_refactored(key, node))) {
+      if (OB_HASH_NOT_EXIST != ret) {
+        LOG_WARN("fail to get node", K(ret), K(key));
+      }
+    } else if (OB_ISNULL(node)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("node is null", K(ret), K(key));
+    } else {
+      io_rate = node->io_rate_;
+    }
+  }
+  return ret;
+}
+
 void ObTableStoreStatMgr::run_report_task()
 {
   int ret = OB_SUCCESS;
@@ -397,7 +469,21 @@ void ObTableStoreStatMgr::run_report_task()
       }
       ATOMIC_STORE(&report_cursor_, end);
     }
+    if (ObTimeUtility::current_time() - last_sample_ts_ >= LOAD_SAMPLE_INTERVAL_US) {
+      sample_load();
+    }
+  }
+}
+
+void ObTableStoreStatMgr::sample_load()
+{
+  const int64_t now = ObTimeUtility::current_time();
+  SpinWLockGuard guard(lock_);
+  for (int64_t i = 0; i < cur_cnt_; ++i) {
+    ObTableStoreStatNode& node = node_pool_[i];
+    node.sample_load(now, node.stat_->get_io_cnt());
   }
+  last_sample_ts_ = now;
 }
 
 int ObTableStoreStatMgr::add_stat(const ObTableStoreStat& stat)
@@ -433,6 +519,7 @@ int ObTableStoreStatMgr::add_stat(const ObTableStoreStat& stat)
             }
             node = lru_tail_;
             node->stat_->reset();
+            node->reset_load();
           }
         }
 
@@ -74,6 +74,8 @@ public:
   bool is_valid() const;
   int add(const ObTableStoreStat& other);
   ObTableStoreStat& operator=(const ObTableStoreStat& other);
+  // micro block reads missing the block cache, an estimate of the disk reads reported to rootserver as iops
+  int64_t get_io_cnt() const;
   TO_STRING_KV(K_(pkey), K_(row_cache_hit_cnt), K_(row_cache_miss_cnt), K_(row_cache_put_cnt), K_(bf_filter_cnt),
       K_(bf_empty_read_cnt), K_(bf_access_cnt), K_(block_cache_hit_cnt), K_(block_cache_miss_cnt), K_(access_row_cnt),
       K_(output_row_cnt), K_(fuse_row_cache_hit_cnt), K_(fuse_row_cache_miss_cnt), K_(fuse_row_cache_put_cnt),
@@ -136,7 +138,9 @@ public:
 struct ObTableStoreStatNode {
 public:
   ObTableStoreStatNode() : pre_(NULL), next_(NULL), stat_(NULL)
-  {}
+  {
+    reset_load();
+  }
   ~ObTableStoreStatNode()
   {
     reset();
@@ -145,10 +149,24 @@ public:
   {
     pre_ = next_ = NULL;
     stat_ = NULL;
+    reset_load();
+  }
+  OB_INLINE void reset_load()
+  {
+    sample_ts_ = 0;
+    sample_io_cnt_ = 0;
+    io_rate_ = 0;
   }
+  void sample_load(const int64_t now, const int64_t io_cnt);
+  // io rate decays in 15 minutes
+  static const int64_t LOAD_DECAY_US = 15 * 60 * 1000 * 1000L;
   ObTableStoreStatNode* pre_;
   ObTableStoreStatNode* next_;
   ObTableStoreStat* stat_;
+  // io count of the last load sample and the decayed ios per second since then
+  int64_t sample_ts_;
+  int64_t sample_io_cnt_;
+  double io_rate_;
 };
 
 class ObTableStoreStatIterator {
@@ -170,6 +188,11 @@ public:
   void destroy();
   static ObTableStoreStatMgr& get_instance();
   int report_stat(const ObTableStoreStat& stat);
+  // accumulated stat of a partition, OB_HASH_NOT_EXIST if it is not accessed recently
+  int get_table_store_stat(const ObTableStoreStatKey& key, ObTableStoreStat& stat);
+  // ios per second of a partition averaged over the last LOAD_DECAY_US, OB_HASH_NOT_EXIST if it is not
+  // accessed recently
+  int get_io_rate(const ObTableStoreStatKey& key, double& io_rate);
 
 private:
   ObTableStoreStatMgr();
@@ -178,6 +201,7 @@ private:
   int get_table_store_stat(const int64_t idx, ObTableStoreStat& stat);
   void run_report_task();
   int add_stat(const ObTableStoreStat& stat);
+  void sample_load();
 
   friend class ObTableStoreStatIterator;
   typedef common::hash::ObHashMap<ObTableStoreStatKey, ObTableStoreStatNode*, common::hash::NoPthreadDefendMode>
@@ -186,6 +210,8 @@ private:
       40000;  // 40000 * (sizeof(key)(16) + sizeof(node*)(8) + sizeof(node)(24) + sizeof(stat)(96)) = 6.25MB
   static const int64_t MAX_PENDDING_CNT = 100000;              // 100000 * sizeof(stat)(96) = 9.2MB
   static const int64_t REPORT_TASK_INTERVAL_US = 1000 * 1000;  // 1 seconds
+  // io rate is sampled every minute
+  static const int64_t LOAD_SAMPLE_INTERVAL_US = 60 * 1000 * 1000L;
 
   class ReportTask : public common::ObTimerTask {
   public:
@@ -214,6 +240,7 @@ private:
   int64_t limit_cnt_;
   ObTableStoreStatNode* lru_head_;
   ObTableStoreStatNode* lru_tail_;
+  int64_t last_sample_ts_;
   ObTableStoreStat stat_array_[DEFAULT_MAX_CNT];
   ObTableStoreStatNode node_pool_[DEFAULT_MAX_CNT];
 
@@ -704,6 +704,8 @@ void ObDupTableRedoSyncTask::reset()
   last_generate_mask_set_ts_ = 0;
   is_mask_set_ready_ = 0;
   create_ts_ = 0;
+  msg_mask_set_.reset();
+  lease_addrs_.reset();
 }
 
 bool ObDupTableRedoSyncTask::is_valid() const
@@ -508,6 +508,23 @@ public:
   {
     is_mask_set_ready_ = is_ready;
   }
+  common::ObMaskSet2<ObAddrLogId>& get_msg_mask_set()
+  {
+    return msg_mask_set_;
+  }
+  const common::ObMaskSet2<ObAddrLogId>& get_msg_mask_set() const
+  {
+    return msg_mask_set_;
+  }
+  ObAddrLogIdArray& get_lease_addrs()
+  {
+    return lease_addrs_;
+  }
+  void reset_mask_set()
+  {
+    msg_mask_set_.reset();
+    lease_addrs_.reset();
+  }
   int64_t get_used_time() const
   {
     return ObTimeUtility::current_time() - create_ts_;
@@ -526,6 +543,11 @@ public:
   int64_t last_generate_mask_set_ts_;
   // Record whether the mask_set is successfully generated
   bool is_mask_set_ready_;
+  // The replicas which hold the lease of duplicated partition, and the ones
+  // which have synced the redo log. They are kept here rather than in
+  // ObPartTransCtx, so that only duplicated table transactions pay for them.
+  common::ObMaskSet2<ObAddrLogId> msg_mask_set_;
+  ObAddrLogIdArray lease_addrs_;
 };
 
 template <typename T>
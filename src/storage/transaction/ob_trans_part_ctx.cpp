@@ -340,8 +340,6 @@ void ObPartTransCtx::reset()
   cur_query_start_time_ = 0;
   batch_commit_state_ = ObBatchCommitState::INIT;
   ctx_dependency_wrap_.reset();
-  dup_table_msg_mask_set_.reset();
-  dup_table_lease_addrs_.reset();
   sp_user_request_ = USER_REQUEST_UNKNOWN;
   same_leader_batch_partitions_count_ = 0;
   clear_log_base_ts_ = OB_INVALID_TIMESTAMP;
@@ -3135,8 +3133,9 @@ int ObPartTransCtx::leader_revoke(const bool first_check, bool& need_release, Ob
     if (OB_SUCC(ret)) {
       is_trans_state_sync_finished_ = false;
       proposal_leader_.reset();
-      dup_table_msg_mask_set_.reset();
-      dup_table_lease_addrs_.reset();
+      if (NULL != redo_sync_task_) {
+        redo_sync_task_->reset_mask_set();
+      }
       for_replay_ = true;
       is_prepare_leader_revoke_ = false;
       enable_new_1pc_ = false;
@@ -10161,7 +10160,10 @@ int ObPartTransCtx::post_redo_log_sync_to_not_mask_addr_(
   } else if (OB_UNLIKELY(!is_dup_table_trans_)) {
     ret = OB_ERR_UNEXPECTED;
     TRANS_LOG(ERROR, "unexpected trans type", KR(ret), K(*this));
-  } else if (OB_FAIL(dup_table_msg_mask_set_.get_not_mask(addr_logid_array))) {
+  } else if (OB_ISNULL(redo_sync_task_)) {
+    ret = OB_ERR_UNEXPECTED;
+    TRANS_LOG(ERROR, "redo sync task is NULL", KR(ret), K(*this));
+  } else if (OB_FAIL(redo_sync_task_->get_msg_mask_set().get_not_mask(addr_logid_array))) {
     TRANS_LOG(WARN, "get not mask addr error", KR(ret), K(*this), K(log_id));
   } else if (OB_FAIL(post_redo_log_sync_request_(addr_logid_array, log_id, log_ts, log_type))) {
     TRANS_LOG(WARN, "post redo log sync request error", KR(ret), K(*this), K(log_id));
@@ -10185,6 +10187,9 @@ int ObPartTransCtx::post_redo_log_sync_request_(
   if (OB_UNLIKELY(!is_dup_table_trans_)) {
     ret = OB_ERR_UNEXPECTED;
     TRANS_LOG(ERROR, "unexpected trans type", KR(ret), K(*this));
+  } else if (OB_ISNULL(redo_sync_task_)) {
+    ret = OB_ERR_UNEXPECTED;
+    TRANS_LOG(ERROR, "redo sync task is NULL", KR(ret), K(*this));
   } else if (OB_ISNULL(rpc = trans_service_->get_dup_table_rpc())) {
     ret = OB_ERR_UNEXPECTED;
     TRANS_LOG(WARN, "dup table rpc is NULL", KR(ret), K(*this));
@@ -10195,7 +10200,7 @@ int ObPartTransCtx::post_redo_log_sync_request_(
         TRANS_LOG(ERROR, "unexpected redo log sync log id", KR(ret), K(*this), K(log_id), K(addr_logid_array));
       } else if (addr_logid_array.at(i).get_addr() == addr_) {
         ObAddrLogId addr_logid(addr_, log_id);
-        if (OB_UNLIKELY(OB_SUCCESS != (tmp_ret = dup_table_msg_mask_set_.mask(addr_logid)))) {
+        if (OB_UNLIKELY(OB_SUCCESS != (tmp_ret = redo_sync_task_->get_msg_mask_set().mask(addr_logid)))) {
           TRANS_LOG(WARN, "dup_table_msg_mask_set mask error", K(tmp_ret), K(msg), K(*this));
         }
       } else if (OB_FAIL(msg.init(self_, addr_logid_array.at(i).get_log_id(), log_ts, log_type, trans_id_))) {
@@ -10230,10 +10235,13 @@ int ObPartTransCtx::handle_redo_log_sync_response(const ObRedoLogSyncResponseMsg
     TRANS_LOG(WARN, "transaction is not master", KR(ret), "context", *this);
   } else if (OB_UNLIKELY(!is_dup_table_trans_)) {
     TRANS_LOG(INFO, "normal ctx resv redo log sync response msg, maybe happen when creat duplicate table", K(*this));
+  } else if (OB_ISNULL(redo_sync_task_)) {
+    ret = OB_ERR_UNEXPECTED;
+    TRANS_LOG(ERROR, "redo sync task is NULL", KR(ret), K(*this));
   } else if (ObRedoLogSyncResponseStatus::OB_REDO_LOG_SYNC_SUCC == msg.get_status() ||
              ObRedoLogSyncResponseStatus::OB_REDO_LOG_SYNC_LEASE_EXPIRED == msg.get_status()) {
     ObAddrLogId addr_logid(msg.get_addr(), msg.get_log_id());
-    if (OB_UNLIKELY(OB_SUCCESS != (tmp_ret = dup_table_msg_mask_set_.mask(addr_logid)))) {
+    if (OB_UNLIKELY(OB_SUCCESS != (tmp_ret = redo_sync_task_->get_msg_mask_set().mask(addr_logid)))) {
       if (OB_MASK_SET_NO_NODE != tmp_ret) {
         TRANS_LOG(WARN, "dup_table_msg_mask_set mask error", K(tmp_ret), K(msg), K(*this));
       }
@@ -10251,7 +10259,7 @@ bool ObPartTransCtx::is_redo_log_sync_finish() const
   // For dup table, there exits two scenerio which need callback txn immedidately:
   // 1. The redo sync task finished successfully
   // 2 The txn is in leader_revoke, and need callback immedidately in order to prevent blocking leader_revoke
-  return !is_dup_table_trans_ || dup_table_msg_mask_set_.is_all_mask();
+  return !is_dup_table_trans_ || (NULL != redo_sync_task_ && redo_sync_task_->get_msg_mask_set().is_all_mask());
 }
 
 bool ObPartTransCtx::is_prepare_leader_revoke() const
@@ -10279,6 +10287,9 @@ int ObPartTransCtx::retry_redo_sync_task(
   if (OB_UNLIKELY(!is_dup_table_trans_)) {
     ret = OB_ERR_UNEXPECTED;
     TRANS_LOG(ERROR, "unexpected trans type", K(ret), K(*this));
+  } else if (OB_ISNULL(redo_sync_task_)) {
+    ret = OB_ERR_UNEXPECTED;
+    TRANS_LOG(ERROR, "redo sync task is NULL", K(ret), K(*this));
   } else if (first_gen) {
     update_durable_log_id_ts_(log_type, log_id, timestamp);
     (void)redo_sync_task_->reset();
@@ -10297,7 +10308,8 @@ int ObPartTransCtx::retry_redo_sync_task(
       // mark the redo log sync task has began
       dup_table_syncing_log_id_ = log_id;
       dup_table_syncing_log_ts_ = timestamp;
-      REC_TRANS_TRACE_EXT(tlog_, alloc_redo_log_sync_task, OB_ID(arg1), dup_table_lease_addrs_.count());
+      REC_TRANS_TRACE_EXT(
+          tlog_, alloc_redo_log_sync_task, OB_ID(arg1), redo_sync_task_->get_lease_addrs().count());
     }
   } else {
     // do nothing
@@ -10323,7 +10335,9 @@ int ObPartTransCtx::retry_redo_sync_task(
       } else if (OB_UNLIKELY(OB_SUCCESS != (tmp_ret = mgr->update_cur_log_id(log_id)))) {
         TRANS_LOG(WARN, "update cur log id error", K(tmp_ret), K(*this), K(log_id));
       } else if (OB_UNLIKELY(OB_SUCCESS != (tmp_ret = mgr->generate_redo_log_sync_set(
-                                                dup_table_msg_mask_set_, dup_table_lease_addrs_, log_id)))) {
+                                                redo_sync_task_->get_msg_mask_set(),
+                                                redo_sync_task_->get_lease_addrs(),
+                                                log_id)))) {
         TRANS_LOG(WARN, "generate redo log sync set error", K(tmp_ret), K(*this), K(log_id));
       } else {
         (void)redo_sync_task_->set_last_generate_mask_set_ts(ObTimeUtility::current_time());
@@ -10343,7 +10357,7 @@ int ObPartTransCtx::retry_redo_sync_task(
   REC_TRANS_TRACE_EXT(tlog_,
       retry_redo_log_sync_task,
       OB_ID(arg1),
-      dup_table_lease_addrs_.count(),
+      NULL == redo_sync_task_ ? 0 : redo_sync_task_->get_lease_addrs().count(),
       OB_ID(log_id),
       log_id,
       OB_ID(log_type),
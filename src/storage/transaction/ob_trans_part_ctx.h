@@ -680,8 +680,7 @@ ObTransSubmitLogCb submit_log_cb_;
   int batch_commit_state_;
   // ELR transaction dep relation
   ObPartTransCtxDependencyWrap ctx_dependency_wrap_;
-  common::ObMaskSet2<ObAddrLogId> dup_table_msg_mask_set_;
-  ObAddrLogIdArray dup_table_lease_addrs_;
+  // only allocated for duplicated table transaction, holds the redo sync state
   ObDupTableRedoSyncTask* redo_sync_task_;
   bool is_dup_table_prepare_;
   uint64_t dup_table_syncing_log_id_;
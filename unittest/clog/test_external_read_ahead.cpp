@@ -0,0 +1,653 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "clog/ob_external_read_ahead.h"
+#include "clog/ob_i_log_engine.h"
+#include "clog/ob_log_line_cache.h"
+#include "share/config/ob_server_config.h"
+
+#include <gtest/gtest.h>
+
+using namespace oceanbase::common;
+
+namespace oceanbase {
+using namespace clog;
+using namespace obrpc;
+using namespace logservice;
+namespace unittest {
+
+// Only read_data_direct is used by read-ahead, it fills every line with a byte derived from its address
+// and can be blocked to keep the read-ahead tasks in flight.
+class MockReadAheadLogEngine : public ObILogEngine {
+public:
+  MockReadAheadLogEngine() : read_count_(0), blocked_(false)
+  {}
+  virtual ~MockReadAheadLogEngine()
+  {}
+
+  static char line_byte(const file_id_t file_id, const offset_t offset)
+  {
+    return static_cast<char>('a' + (file_id + offset / ObLogLineCache::LINE_SIZE) % 26);
+  }
+  int64_t get_read_count() const
+  {
+    return ATOMIC_LOAD(&read_count_);
+  }
+  void set_blocked(const bool blocked)
+  {
+    ATOMIC_STORE(&blocked_, blocked);
+  }
+
+  virtual int read_data_direct(const ObReadParam& param, ObReadBuf& rbuf, ObReadRes& res, ObReadCost& cost)
+  {
+    while (ATOMIC_LOAD(&blocked_)) {
+      usleep(1000);
+    }
+    MEMSET(rbuf.buf_, line_byte(param.file_id_, param.offset_), param.read_len_);
+    res.buf_ = rbuf.buf_;
+    res.data_len_ = param.read_len_;
+    ATOMIC_INC(&read_count_);
+    return OB_SUCCESS;
+  }
+
+  virtual ObIRawLogIterator* alloc_raw_log_iterator(const file_id_t start_file_id, const file_id_t end_file_id,
+      const offset_t offset, const int64_t timeout)
+  {
+    return NULL;
+  }
+  virtual void revert_raw_log_iterator(ObIRawLogIterator* iter)
+  {}
+  virtual int read_log_by_location(const ObReadParam& param, ObReadBuf& buf, ObLogEntry& entry)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int read_log_by_location(const ObReadParam& param, ObReadBuf& buf, ObLogEntry& entry, ObReadCost& cost)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int read_log_by_location(const ObLogTask& log_task, ObReadBuf& buf, ObLogEntry& entry)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int get_clog_real_length(const ObReadParam& param, int64_t& real_length)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int read_data_from_hot_cache(const file_id_t want_file_id, const offset_t want_offset,
+      const int64_t want_size, char* user_buf)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int submit_flush_task(FlushTask* task)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int submit_net_task(const share::ObCascadMemberList& mem_list, const common::ObPartitionKey& key,
+      const ObPushLogMode push_mode, ObILogNetTask* task)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int submit_fetch_log_resp(const common::ObAddr& server, const int64_t cluster_id,
+      const common::ObPartitionKey& key, const int64_t network_limit, const ObPushLogMode push_mode,
+      ObILogNetTask* task)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int submit_push_ms_log_req(const common::ObAddr& server, const int64_t cluster_id,
+      const common::ObPartitionKey& key, ObILogNetTask* task)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int submit_fake_ack(const common::ObAddr& server, const common::ObPartitionKey& key, const uint64_t log_id,
+      const common::ObProposalID proposal_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int submit_fake_push_log_req(const common::ObMemberList& member_list, const common::ObPartitionKey& key,
+      const uint64_t log_id, const common::ObProposalID proposal_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int submit_log_ack(const common::ObAddr& server, const int64_t dst_cluster_id,
+      const common::ObPartitionKey& key, const uint64_t log_id, const common::ObProposalID proposal_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int standby_query_sync_start_id(const common::ObAddr& server, const int64_t dst_cluster_id,
+      const common::ObPartitionKey& key, const int64_t send_ts)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int submit_sync_start_id_resp(const common::ObAddr& server, const int64_t dst_cluster_id,
+      const common::ObPartitionKey& key, const int64_t original_send_ts, const uint64_t sync_start_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int submit_standby_log_ack(const common::ObAddr& server, const int64_t dst_cluster_id,
+      const common::ObPartitionKey& key, const uint64_t log_id, const common::ObProposalID proposal_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int submit_renew_ms_log_ack(const common::ObAddr& server, const int64_t dst_cluster_id,
+      const common::ObPartitionKey& key, const uint64_t log_id, const int64_t submit_timestamp,
+      const common::ObProposalID proposal_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int fetch_log_from_all_follower(const common::ObMemberList& mem_list, const common::ObPartitionKey& key,
+      const uint64_t start_id, const uint64_t end_id, const common::ObProposalID proposal_id,
+      const uint64_t max_confirmed_log_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int fetch_log_from_leader(const common::ObAddr& server, const int64_t dst_cluster_id,
+      const common::ObPartitionKey& key, const ObFetchLogType fetch_type, const uint64_t start_id,
+      const uint64_t end_id, const common::ObProposalID proposal_id, const common::ObReplicaType replica_type,
+      const uint64_t max_confirmed_log_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int submit_check_rebuild_req(const common::ObAddr& server, const int64_t dst_cluster_id,
+      const common::ObPartitionKey& key, const uint64_t start_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int fetch_register_server(const common::ObAddr& server, const int64_t dst_cluster_id,
+      const common::ObPartitionKey& key, const common::ObRegion& region, const common::ObIDC& idc,
+      const common::ObReplicaType replica_type, const int64_t next_replay_ts, const bool is_request_leader,
+      const bool is_need_force_register)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int response_register_server(const common::ObAddr& server, const int64_t dst_cluster_id,
+      const common::ObPartitionKey& key, const bool is_assign_parent_succeed,
+      const share::ObCascadMemberList& candidate_list, const int32_t msg_type)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int request_replace_sick_child(const common::ObAddr& server, const int64_t dst_cluster_id,
+      const common::ObPartitionKey& key, const common::ObAddr& sick_child)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int reject_server(const common::ObAddr& server, const int64_t dst_cluster_id,
+      const common::ObPartitionKey& key, const int32_t msg_type)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int notify_restore_log_finished(const common::ObAddr& server, const int64_t dst_cluster_id,
+      const common::ObPartitionKey& key, const uint64_t log_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int notify_reregister(const common::ObAddr& server, const int64_t dst_cluster_id,
+      const common::ObPartitionKey& key, const share::ObCascadMember& new_leader)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int submit_prepare_rqst(const common::ObMemberList& mem_list, const common::ObPartitionKey& key,
+      const common::ObProposalID proposal_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int submit_standby_prepare_rqst(const common::ObMemberList& mem_list, const common::ObPartitionKey& key,
+      const common::ObProposalID proposal_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int broadcast_info(const common::ObMemberList& mem_list, const common::ObPartitionKey& key,
+      const common::ObReplicaType& replica_type, const uint64_t max_confirmed_log_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int submit_confirmed_info(const share::ObCascadMemberList& mem_list, const common::ObPartitionKey& key,
+      const uint64_t log_id, const ObConfirmedInfo& confirmed_info, const bool batch_committed)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int submit_renew_ms_confirmed_info(const share::ObCascadMemberList& mem_list,
+      const common::ObPartitionKey& key, const uint64_t log_id, const common::ObProposalID& ms_proposal_id,
+      const ObConfirmedInfo& confirmed_info)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int prepare_response(const common::ObAddr& server, const int64_t dst_cluster_id,
+      const common::ObPartitionKey& partition_key, const common::ObProposalID proposal_id, const uint64_t max_log_id,
+      const int64_t max_log_ts)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int standby_prepare_response(const common::ObAddr& server, const int64_t dst_cluster_id,
+      const common::ObPartitionKey& partition_key, const common::ObProposalID proposal_id, const uint64_t ms_log_id,
+      const int64_t membership_version, const common::ObMemberList& member_list)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int send_keepalive_msg(const common::ObAddr& server, const int64_t cluster_id,
+      const common::ObPartitionKey& partition_key, const uint64_t next_log_id, const int64_t next_log_ts_lb,
+      const uint64_t deliver_cnt)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int send_restore_alive_msg(const common::ObAddr& server, const int64_t dst_cluster_id,
+      const common::ObPartitionKey& partition_key, const uint64_t start_log_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int send_restore_alive_req(const common::ObAddr& server, const common::ObPartitionKey& partition_key)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int send_restore_alive_resp(const common::ObAddr& server, const int64_t dst_cluster_id,
+      const common::ObPartitionKey& partition_key)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int notify_restore_leader_takeover(const common::ObAddr& server, const common::ObPartitionKey& key)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int send_leader_max_log_msg(const common::ObAddr& server, const int64_t cluster_id,
+      const common::ObPartitionKey& partition_key, const int64_t switchover_epoch, const uint64_t max_log_id,
+      const int64_t next_log_ts)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int send_sync_log_archive_progress_msg(const common::ObAddr& server, const int64_t cluster_id,
+      const common::ObPartitionKey& partition_key, const ObPGLogArchiveStatus& status)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int notify_follower_log_missing(const common::ObAddr& server, const int64_t cluster_id,
+      const common::ObPartitionKey& partition_key, const uint64_t start_log_id, const bool is_in_member_list,
+      const int32_t msg_type)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int send_restore_check_rqst(const common::ObAddr& server, const int64_t dst_cluster_id,
+      const common::ObPartitionKey& key, const ObRestoreCheckType restore_type)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int send_query_restore_end_id_resp(const common::ObAddr& server, const int64_t cluster_id,
+      const common::ObPartitionKey& partition_key, const uint64_t last_restore_log_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual void update_clog_info(const int64_t max_submit_timestamp)
+  {}
+  virtual void update_clog_info(const common::ObPartitionKey& partition_key, const uint64_t log_id,
+      const int64_t submit_timestamp)
+  {}
+  virtual int reset_clog_info_block()
+  {
+    return OB_SUCCESS;
+  }
+  virtual int get_clog_info_handler(const file_id_t file_id, ObCommitInfoBlockHandler& handler)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int get_remote_membership_status(const common::ObAddr& server, const int64_t dst_cluster_id,
+      const common::ObPartitionKey& partition_key, int64_t& timestamp, uint64_t& max_confirmed_log_id,
+      bool& remote_replica_is_normal)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int64_t get_free_quota() const
+  {
+    return 0;
+  }
+  virtual bool is_disk_space_enough() const
+  {
+    return true;
+  }
+  virtual int submit_batch_log(const common::ObMemberList& member_list, const transaction::ObTransID& trans_id,
+      const common::ObPartitionArray& partition_array, const ObLogInfoArray& log_info_array)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int submit_batch_ack(const common::ObAddr& leader, const transaction::ObTransID& trans_id,
+      const ObBatchAckArray& batch_ack_array)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int query_remote_log(const common::ObAddr& server, const common::ObPartitionKey& partition_key,
+      const uint64_t log_id, transaction::ObTransID& trans_id, int64_t& submit_timestamp)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int get_clog_file_id_range(file_id_t& min_file_id, file_id_t& max_file_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual uint32_t get_clog_min_using_file_id() const
+  {
+    return 0;
+  }
+  virtual uint32_t get_clog_min_file_id() const
+  {
+    return 0;
+  }
+  virtual uint32_t get_clog_max_file_id() const
+  {
+    return 0;
+  }
+  virtual int get_cursor_batch(const common::ObPartitionKey& pkey, const uint64_t query_log_id,
+      ObGetCursorResult& result)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int get_cursor_batch(const common::ObPartitionKey& pkey, const uint64_t query_log_id,
+      ObLogCursorExt& log_cursor, ObGetCursorResult& result, uint64_t& cursor_start_log_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int get_cursor_batch_from_file(const common::ObPartitionKey& pkey, const uint64_t query_log_id,
+      ObGetCursorResult& result)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int get_cursor(const common::ObPartitionKey& pkey, const uint64_t query_log_id,
+      ObLogCursorExt& log_cursor_ext)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int submit_cursor(const common::ObPartitionKey& partition_key, const uint64_t log_id,
+      const ObLogCursorExt& log_cursor_ext)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int submit_cursor(const common::ObPartitionKey& partition_key, const uint64_t log_id,
+      const ObLogCursorExt& log_cursor_ext, const common::ObMemberList& memberlist, const int64_t replica_num,
+      const int64_t memberlist_version)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int query_max_ilog_id(const common::ObPartitionKey& pkey, uint64_t& ret_max_ilog_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int query_max_flushed_ilog_id(const common::ObPartitionKey& pkey, uint64_t& ret_max_ilog_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int get_ilog_memstore_min_log_id_and_ts(const common::ObPartitionKey& pkey, uint64_t& min_log_id,
+      int64_t& min_log_ts)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int locate_by_timestamp(const common::ObPartitionKey& pkey, const int64_t start_ts, uint64_t& target_log_id,
+      int64_t& target_log_timestamp)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int locate_ilog_file_by_log_id(const common::ObPartitionKey& pkey, const uint64_t start_log_id,
+      uint64_t& end_log_id, file_id_t& ilog_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int fill_file_id_cache()
+  {
+    return OB_SUCCESS;
+  }
+  virtual int ensure_log_continuous_in_file_id_cache(const common::ObPartitionKey& partition_key, const uint64_t log_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int get_ilog_file_id_range(file_id_t& min_file_id, file_id_t& max_file_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int query_next_ilog_file_id(file_id_t& next_ilog_file_id)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int get_index_info_block_map(const file_id_t file_id, IndexInfoBlockMap& index_info_block_map)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int check_need_block_log(const file_id_t cur_file_id, bool &is_need) const
+  {
+    return OB_SUCCESS;
+  }
+  virtual int check_clog_exist(const common::ObPartitionKey &partition_key, const uint64_t log_id, bool &exist)
+  {
+    return OB_SUCCESS;
+  }
+  virtual int read_uncompressed_data_from_hot_cache(const common::ObAddr& addr, const int64_t seq,
+      const file_id_t want_file_id, const offset_t want_offset, const int64_t want_size, char* user_buf,
+      const int64_t buf_size, int64_t& origin_data_len)
+  {
+    return OB_SUCCESS;
+  }
+  virtual ObLogCache* get_ilog_log_cache()
+  {
+    return NULL;
+  }
+  virtual int check_is_clog_obsoleted(const common::ObPartitionKey& partition_key, const file_id_t file_id,
+      const offset_t offset, bool& is_obsoleted) const
+  {
+    return OB_SUCCESS;
+  }
+  virtual bool is_clog_disk_hang() const
+  {
+    return false;
+  }
+
+private:
+  int64_t read_count_;
+  bool blocked_;
+};
+
+class TestExtLogReadAhead : public ::testing::Test {
+public:
+  static const int64_t LINE_SIZE = ObLogLineCache::LINE_SIZE;
+  static const int64_t ITEM_COUNT = 2;
+  static const file_id_t FILE_ID = 1;
+  static const int64_t WAIT_TIMEOUT = 10 * 1000 * 1000;
+
+  virtual void SetUp()
+  {
+    GCONF._extlog_read_ahead_window_size.set_value("8M");
+    GCONF._extlog_read_ahead_io_budget.set_value("256M");
+    ASSERT_EQ(OB_SUCCESS, line_cache_.init(2, 1, "TestReadAhead"));
+    ASSERT_EQ(OB_SUCCESS, read_ahead_.init(line_cache_, &log_engine_));
+    ASSERT_EQ(OB_SUCCESS, init_stream(stream_buf_, stream_));
+    stream_seq_.self_.set_ip_addr("127.0.0.1", 8888);
+    stream_seq_.seq_ts_ = 1;
+  }
+  virtual void TearDown()
+  {
+    log_engine_.set_blocked(false);
+    read_ahead_.destroy();
+    line_cache_.destroy();
+    stream_->~ObStream();
+    GCONF._extlog_read_ahead_window_size.set_value("8M");
+    GCONF._extlog_read_ahead_io_budget.set_value("256M");
+  }
+
+  int init_stream(char* buf, ObStream*& stream)
+  {
+    ObLogOpenStreamReq::ParamArray params;
+    ObLogOpenStreamReq::Param param;
+    int ret = OB_SUCCESS;
+    for (int64_t i = 0; OB_SUCC(ret) && i < ITEM_COUNT; i++) {
+      param.pkey_ = ObPartitionKey(combine_id(1, 3001), i, ITEM_COUNT);
+      param.start_log_id_ = 1;
+      ret = params.push_back(param);
+    }
+    if (OB_SUCC(ret)) {
+      stream = new (buf) ObStream();
+      ret = stream->init(params, 10 * 1000 * 1000, ObStream::LiboblogInstanceId());
+    }
+    return ret;
+  }
+  // the stream is owned by the test, cursors are filled as the fetcher would after a round
+  ObStreamItem& item(const int64_t idx)
+  {
+    return *const_cast<ObStreamItem*>(stream_->get_item(idx));
+  }
+  void add_cursor(ObStreamItem& stream_item, const offset_t offset, const int32_t size)
+  {
+    stream_item.cursor_array_[stream_item.cursor_array_size_++].reset(FILE_ID, offset, size, 0, 0, false);
+  }
+  bool wait_in_flight_done()
+  {
+    const int64_t start_ts = ObTimeUtility::current_time();
+    while (read_ahead_.get_in_flight_size() > 0 && ObTimeUtility::current_time() - start_ts < WAIT_TIMEOUT) {
+      usleep(1000);
+    }
+    return 0 == read_ahead_.get_in_flight_size();
+  }
+  // whether the line holding offset is ready in line cache, the data is checked if it is
+  bool is_line_cached(const offset_t offset)
+  {
+    char* line = NULL;
+    bool need_load_data = true;
+    bool bret = false;
+    if (OB_SUCCESS == line_cache_.get_line(FILE_ID, offset, WAIT_TIMEOUT, line, need_load_data)) {
+      if (need_load_data) {
+        EXPECT_EQ(OB_SUCCESS, line_cache_.mark_line_status(FILE_ID, offset, false));
+      } else {
+        const offset_t offset_in_line = ObLogLineCache::offset_in_line(offset);
+        EXPECT_EQ(MockReadAheadLogEngine::line_byte(FILE_ID, offset), line[offset_in_line]);
+        bret = true;
+      }
+      EXPECT_EQ(OB_SUCCESS, line_cache_.revert_line(FILE_ID, offset, 0));
+    }
+    return bret;
+  }
+
+protected:
+  MockReadAheadLogEngine log_engine_;
+  ObLogLineCache line_cache_;
+  ObExtLogReadAhead read_ahead_;
+  ObStreamSeq stream_seq_;
+  char stream_buf_[sizeof(ObStream) + ITEM_COUNT * sizeof(ObStreamItem)] CACHE_ALIGNED;
+  ObStream* stream_;
+};
+
+TEST_F(TestExtLogReadAhead, lagging_stream)
+{
+  // the first log is already served, the second one spans line 1 and 2
+  add_cursor(item(0), static_cast<offset_t>(8 * LINE_SIZE), 100);
+  add_cursor(item(0), static_cast<offset_t>(2 * LINE_SIZE - 50), 100);
+  item(0).next_cursor_ = 1;
+  // lines shared by partitions are read once
+  add_cursor(item(1), static_cast<offset_t>(LINE_SIZE + 100), 100);
+  add_cursor(item(1), static_cast<offset_t>(4 * LINE_SIZE), 100);
+
+  ASSERT_EQ(OB_SUCCESS, read_ahead_.submit(stream_seq_, *stream_));
+  ASSERT_TRUE(wait_in_flight_done());
+  ASSERT_EQ(3, log_engine_.get_read_count());
+  ASSERT_TRUE(is_line_cached(static_cast<offset_t>(LINE_SIZE + 100)));
+  ASSERT_TRUE(is_line_cached(static_cast<offset_t>(2 * LINE_SIZE)));
+  ASSERT_TRUE(is_line_cached(static_cast<offset_t>(4 * LINE_SIZE + 100)));
+  ASSERT_FALSE(is_line_cached(static_cast<offset_t>(8 * LINE_SIZE)));
+  ASSERT_FALSE(is_line_cached(0));
+
+  // the next round of the stream is served from line cache without disk read
+  ASSERT_EQ(OB_SUCCESS, read_ahead_.submit(stream_seq_, *stream_));
+  ASSERT_TRUE(wait_in_flight_done());
+  ASSERT_EQ(3, log_engine_.get_read_count());
+
+  // all logs are served, nothing to read ahead
+  item(0).next_cursor_ = item(0).cursor_array_size_;
+  item(1).next_cursor_ = item(1).cursor_array_size_;
+  ASSERT_EQ(OB_SUCCESS, read_ahead_.submit(stream_seq_, *stream_));
+  ASSERT_EQ(0, read_ahead_.get_in_flight_size());
+}
+
+TEST_F(TestExtLogReadAhead, turned_off)
+{
+  add_cursor(item(0), 0, 100);
+
+  GCONF._extlog_read_ahead_window_size.set_value("0");
+  ASSERT_EQ(OB_SUCCESS, read_ahead_.submit(stream_seq_, *stream_));
+  ASSERT_EQ(0, read_ahead_.get_in_flight_size());
+
+  // a window smaller than one line turns read-ahead off too
+  GCONF._extlog_read_ahead_window_size.set_value("32K");
+  ASSERT_EQ(OB_SUCCESS, read_ahead_.submit(stream_seq_, *stream_));
+  ASSERT_EQ(0, read_ahead_.get_in_flight_size());
+
+  GCONF._extlog_read_ahead_window_size.set_value("8M");
+  GCONF._extlog_read_ahead_io_budget.set_value("0");
+  ASSERT_EQ(OB_SUCCESS, read_ahead_.submit(stream_seq_, *stream_));
+  ASSERT_EQ(0, read_ahead_.get_in_flight_size());
+
+  usleep(100 * 1000);
+  ASSERT_EQ(0, log_engine_.get_read_count());
+}
+
+TEST_F(TestExtLogReadAhead, window)
+{
+  // the window holds two lines, the third one is left to the next round
+  GCONF._extlog_read_ahead_window_size.set_value("128K");
+  GCONF._extlog_read_ahead_io_budget.set_value("128K");
+  add_cursor(item(0), 0, 100);
+  add_cursor(item(0), static_cast<offset_t>(LINE_SIZE), 100);
+  add_cursor(item(0), static_cast<offset_t>(2 * LINE_SIZE), 100);
+
+  log_engine_.set_blocked(true);
+  ASSERT_EQ(OB_SUCCESS, read_ahead_.submit(stream_seq_, *stream_));
+  ASSERT_EQ(2 * LINE_SIZE, read_ahead_.get_in_flight_size());
+
+  // the window of the stream is full, the task is dropped
+  ASSERT_EQ(OB_SUCCESS, read_ahead_.submit(stream_seq_, *stream_));
+  ASSERT_EQ(2 * LINE_SIZE, read_ahead_.get_in_flight_size());
+
+  // the I/O budget is exhausted, tasks of other streams are dropped
+  ObStreamSeq other_seq = stream_seq_;
+  other_seq.seq_ts_ = 2;
+  ASSERT_EQ(OB_SUCCESS, read_ahead_.submit(other_seq, *stream_));
+  ASSERT_EQ(2 * LINE_SIZE, read_ahead_.get_in_flight_size());
+
+  // the window is released once the lines are loaded
+  log_engine_.set_blocked(false);
+  ASSERT_TRUE(wait_in_flight_done());
+  ASSERT_EQ(2, log_engine_.get_read_count());
+  ASSERT_FALSE(is_line_cached(static_cast<offset_t>(2 * LINE_SIZE)));
+
+  // the stream moves on and reads ahead the next line
+  item(0).next_cursor_ = 2;
+  ASSERT_EQ(OB_SUCCESS, read_ahead_.submit(stream_seq_, *stream_));
+  ASSERT_TRUE(wait_in_flight_done());
+  ASSERT_EQ(3, log_engine_.get_read_count());
+  ASSERT_TRUE(is_line_cached(static_cast<offset_t>(2 * LINE_SIZE)));
+}
+
+TEST_F(TestExtLogReadAhead, destroy)
+{
+  add_cursor(item(0), 0, 100);
+  read_ahead_.destroy();
+  ASSERT_EQ(OB_NOT_INIT, read_ahead_.submit(stream_seq_, *stream_));
+
+  // in-flight sizes are reset by init
+  ASSERT_EQ(OB_SUCCESS, read_ahead_.init(line_cache_, &log_engine_));
+  ASSERT_EQ(OB_INIT_TWICE, read_ahead_.init(line_cache_, &log_engine_));
+  ASSERT_EQ(0, read_ahead_.get_in_flight_size());
+  ASSERT_EQ(OB_SUCCESS, read_ahead_.submit(stream_seq_, *stream_));
+  ASSERT_TRUE(wait_in_flight_done());
+  ASSERT_EQ(1, log_engine_.get_read_count());
+}
+
+}  // end namespace unittest
+}  // end namespace oceanbase
+
+int main(int argc, char** argv)
+{
+  OB_LOGGER.set_file_name("test_external_read_ahead.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
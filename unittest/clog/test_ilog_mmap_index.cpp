@@ -0,0 +1,267 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include "clog/ob_ilog_mmap_index.h"
+#include "clog/ob_ilog_per_file_cache.h"
+#include "clog/ob_log_entry.h"
+
+using namespace oceanbase::common;
+namespace oceanbase {
+using namespace clog;
+namespace unittest {
+class TestObIlogMmapIndex : public ::testing::Test {
+public:
+  virtual void SetUp()
+  {
+    (void)system("rm -rf ./test_ilog_mmap_index_dir ./test_ilog_mmap_index_dir_index");
+    (void)system("mkdir -p ./test_ilog_mmap_index_dir");
+  }
+  virtual void TearDown()
+  {
+    (void)system("rm -rf ./test_ilog_mmap_index_dir ./test_ilog_mmap_index_dir_index");
+  }
+};
+
+// the index remembers size and mtime of the ilog file it is built from
+static void write_ilog_file(const file_id_t file_id, const int64_t size)
+{
+  char path[128];
+  snprintf(path, sizeof(path), "./test_ilog_mmap_index_dir/%u", file_id);
+  FILE* fp = fopen(path, "w");
+  ASSERT_TRUE(NULL != fp);
+  for (int64_t i = 0; i < size; i++) {
+    fputc('x', fp);
+  }
+  fclose(fp);
+}
+
+static void init_raw_array(ObIndexEntry* entries, const int64_t count, const ObPartitionKey& pkey, RawArray& raw_array)
+{
+  raw_array.arr_ = entries;
+  raw_array.count_ = count;
+  for (int64_t j = 0; j < count; j++) {
+    EXPECT_EQ(OB_SUCCESS, entries[j].init(pkey, 1 + j, 9, static_cast<offset_t>(j * 64), 64, 2000 + j, j, true));
+  }
+}
+
+static const int64_t PARTITION_COUNT = 16;
+static const int64_t LOG_COUNT_PER_PARTITION = 100;
+
+TEST_F(TestObIlogMmapIndex, persist_and_query)
+{
+  const file_id_t ilog_file_id = 3;
+  const int64_t count = PARTITION_COUNT * LOG_COUNT_PER_PARTITION;
+  ObIndexEntry* entries = new ObIndexEntry[count];
+  RawArray raw_array;
+  raw_array.arr_ = entries;
+  raw_array.count_ = count;
+  for (int64_t i = 0; i < PARTITION_COUNT; i++) {
+    ObPartitionKey pkey(combine_id(1001, 50000 + i), 0, 1);
+    for (int64_t j = 0; j < LOG_COUNT_PER_PARTITION; j++) {
+      const uint64_t log_id = 10 + i + j;
+      EXPECT_EQ(OB_SUCCESS,
+          entries[i * LOG_COUNT_PER_PARTITION + j].init(
+              pkey, log_id, 7, static_cast<offset_t>(j * 512), 512, 1000 + log_id, log_id, false));
+    }
+  }
+  qsort(raw_array.arr_, raw_array.count_, sizeof(ObIndexEntry), ilog_entry_comparator);
+
+  write_ilog_file(ilog_file_id, 4096);
+  ObIlogMmapIndexMgr mgr;
+  ObLogCursorExt csr_arr[8];
+  ObGetCursorResult result(csr_arr, 8);
+  ObPartitionKey pkey(combine_id(1001, 50005), 0, 1);
+  EXPECT_EQ(OB_SUCCESS, mgr.init("./test_ilog_mmap_index_dir"));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, mgr.get_cursor(ilog_file_id, pkey, 20, result));
+  EXPECT_EQ(OB_SUCCESS, mgr.persist(ilog_file_id, raw_array));
+  // the index is not written before the persist task runs
+  EXPECT_NE(0, access("./test_ilog_mmap_index_dir_index/3", F_OK));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, mgr.get_cursor(ilog_file_id, pkey, 20, result));
+  EXPECT_EQ(OB_SUCCESS, mgr.do_persist_tasks());
+
+  // log ids of partition 50005 are [15, 114]
+  EXPECT_EQ(OB_SUCCESS, mgr.get_cursor(ilog_file_id, pkey, 20, result));
+  EXPECT_EQ(8, result.ret_len_);
+  EXPECT_EQ(7, result.csr_arr_[0].get_file_id());
+  EXPECT_EQ(5 * 512, result.csr_arr_[0].get_offset());
+  EXPECT_EQ(1020, result.csr_arr_[0].get_submit_timestamp());
+  EXPECT_EQ(1027, result.csr_arr_[7].get_submit_timestamp());
+
+  result.ret_len_ = 0;
+  EXPECT_EQ(OB_SUCCESS, mgr.get_cursor(ilog_file_id, pkey, 112, result));
+  EXPECT_EQ(3, result.ret_len_);
+  EXPECT_EQ(OB_CURSOR_NOT_EXIST, mgr.get_cursor(ilog_file_id, pkey, 115, result));
+  EXPECT_EQ(OB_CURSOR_NOT_EXIST, mgr.get_cursor(ilog_file_id, pkey, 14, result));
+
+  ObPartitionKey not_exist_pkey(combine_id(1001, 60000), 0, 1);
+  EXPECT_EQ(OB_CURSOR_NOT_EXIST, mgr.get_cursor(ilog_file_id, not_exist_pkey, 20, result));
+
+  EXPECT_EQ(OB_SUCCESS, mgr.remove(ilog_file_id));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, mgr.get_cursor(ilog_file_id, pkey, 20, result));
+  mgr.destroy();
+  delete[] entries;
+}
+
+TEST_F(TestObIlogMmapIndex, reopen_after_restart)
+{
+  const file_id_t ilog_file_id = 5;
+  const int64_t count = LOG_COUNT_PER_PARTITION;
+  ObIndexEntry* entries = new ObIndexEntry[count];
+  RawArray raw_array;
+  ObPartitionKey pkey(combine_id(1001, 50000), 3, 4);
+  init_raw_array(entries, count, pkey, raw_array);
+  write_ilog_file(ilog_file_id, 4096);
+
+  ObLogCursorExt csr_arr[1];
+  ObGetCursorResult result(csr_arr, 1);
+  {
+    ObIlogMmapIndexMgr mgr;
+    EXPECT_EQ(OB_SUCCESS, mgr.init("./test_ilog_mmap_index_dir/"));
+    EXPECT_EQ(OB_SUCCESS, mgr.persist(ilog_file_id, raw_array));
+    EXPECT_EQ(OB_SUCCESS, mgr.do_persist_tasks());
+  }
+  {
+    ObIlogMmapIndexMgr mgr;
+    EXPECT_EQ(OB_SUCCESS, mgr.init("./test_ilog_mmap_index_dir"));
+    EXPECT_EQ(OB_SUCCESS, mgr.get_cursor(ilog_file_id, pkey, 100, result));
+    EXPECT_EQ(1, result.ret_len_);
+    EXPECT_EQ(99 * 64, result.csr_arr_[0].get_offset());
+    EXPECT_TRUE(result.csr_arr_[0].is_batch_committed());
+  }
+  delete[] entries;
+}
+
+TEST_F(TestObIlogMmapIndex, stale_index)
+{
+  const file_id_t ilog_file_id = 6;
+  const int64_t count = LOG_COUNT_PER_PARTITION;
+  ObIndexEntry* entries = new ObIndexEntry[count];
+  RawArray raw_array;
+  ObPartitionKey pkey(combine_id(1001, 50000), 0, 1);
+  init_raw_array(entries, count, pkey, raw_array);
+  write_ilog_file(ilog_file_id, 4096);
+
+  ObLogCursorExt csr_arr[1];
+  ObGetCursorResult result(csr_arr, 1);
+  {
+    ObIlogMmapIndexMgr mgr;
+    EXPECT_EQ(OB_SUCCESS, mgr.init("./test_ilog_mmap_index_dir"));
+    EXPECT_EQ(OB_SUCCESS, mgr.persist(ilog_file_id, raw_array));
+    EXPECT_EQ(OB_SUCCESS, mgr.do_persist_tasks());
+  }
+  // the ilog file id is reused by another ilog file
+  write_ilog_file(ilog_file_id, 8192);
+  {
+    ObIlogMmapIndexMgr mgr;
+    EXPECT_EQ(OB_SUCCESS, mgr.init("./test_ilog_mmap_index_dir"));
+    EXPECT_EQ(OB_ENTRY_NOT_EXIST, mgr.get_cursor(ilog_file_id, pkey, 10, result));
+    // the stale index is removed, a new one can be persisted and used
+    EXPECT_NE(0, access("./test_ilog_mmap_index_dir_index/6", F_OK));
+    EXPECT_EQ(OB_SUCCESS, mgr.persist(ilog_file_id, raw_array));
+    EXPECT_EQ(OB_SUCCESS, mgr.do_persist_tasks());
+    EXPECT_EQ(OB_SUCCESS, mgr.get_cursor(ilog_file_id, pkey, 10, result));
+    EXPECT_EQ(9 * 64, result.csr_arr_[0].get_offset());
+  }
+  delete[] entries;
+}
+
+TEST_F(TestObIlogMmapIndex, corrupted_cursor)
+{
+  const file_id_t ilog_file_id = 7;
+  const int64_t count = LOG_COUNT_PER_PARTITION;
+  ObIndexEntry* entries = new ObIndexEntry[count];
+  RawArray raw_array;
+  ObPartitionKey pkey(combine_id(1001, 50000), 0, 1);
+  init_raw_array(entries, count, pkey, raw_array);
+  write_ilog_file(ilog_file_id, 4096);
+
+  ObLogCursorExt csr_arr[1];
+  ObGetCursorResult result(csr_arr, 1);
+  {
+    ObIlogMmapIndexMgr mgr;
+    EXPECT_EQ(OB_SUCCESS, mgr.init("./test_ilog_mmap_index_dir"));
+    EXPECT_EQ(OB_SUCCESS, mgr.persist(ilog_file_id, raw_array));
+    EXPECT_EQ(OB_SUCCESS, mgr.do_persist_tasks());
+  }
+  // flip the last byte, which is in the cursor array
+  FILE* fp = fopen("./test_ilog_mmap_index_dir_index/7", "r+");
+  ASSERT_TRUE(NULL != fp);
+  ASSERT_EQ(0, fseek(fp, -1, SEEK_END));
+  const int ch = fgetc(fp);
+  ASSERT_EQ(0, fseek(fp, -1, SEEK_END));
+  fputc(ch ^ 0xff, fp);
+  fclose(fp);
+  {
+    ObIlogMmapIndexMgr mgr;
+    EXPECT_EQ(OB_SUCCESS, mgr.init("./test_ilog_mmap_index_dir"));
+    EXPECT_EQ(OB_ENTRY_NOT_EXIST, mgr.get_cursor(ilog_file_id, pkey, 10, result));
+  }
+  delete[] entries;
+}
+
+TEST_F(TestObIlogMmapIndex, pending_persist_tasks)
+{
+  const int64_t count = LOG_COUNT_PER_PARTITION;
+  ObIndexEntry* entries = new ObIndexEntry[count];
+  RawArray raw_array;
+  ObPartitionKey pkey(combine_id(1001, 50000), 0, 1);
+  init_raw_array(entries, count, pkey, raw_array);
+
+  ObLogCursorExt csr_arr[1];
+  ObGetCursorResult result(csr_arr, 1);
+  ObIlogMmapIndexMgr mgr;
+  EXPECT_EQ(OB_SUCCESS, mgr.init("./test_ilog_mmap_index_dir"));
+  for (file_id_t file_id = 1; file_id <= 8; file_id++) {
+    write_ilog_file(file_id, 4096);
+    EXPECT_EQ(OB_SUCCESS, mgr.persist(file_id, raw_array));
+  }
+  // the same file is not queued twice, and the pending tasks are bounded
+  EXPECT_EQ(OB_SUCCESS, mgr.persist(1, raw_array));
+  EXPECT_EQ(OB_EAGAIN, mgr.persist(9, raw_array));
+  // the removed file is not written
+  EXPECT_EQ(OB_SUCCESS, mgr.remove(2));
+  EXPECT_EQ(OB_SUCCESS, mgr.persist(9, raw_array));
+  write_ilog_file(9, 4096);
+  EXPECT_EQ(OB_SUCCESS, mgr.do_persist_tasks());
+  EXPECT_NE(0, access("./test_ilog_mmap_index_dir_index/2", F_OK));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, mgr.get_cursor(2, pkey, 10, result));
+  for (file_id_t file_id = 1; file_id <= 9; file_id++) {
+    if (2 != file_id) {
+      EXPECT_EQ(OB_SUCCESS, mgr.get_cursor(file_id, pkey, 10, result));
+      EXPECT_EQ(9 * 64, result.csr_arr_[0].get_offset());
+    }
+  }
+
+  // failure of writing one index does not stop the others
+  write_ilog_file(10, 4096);
+  EXPECT_EQ(OB_SUCCESS, mgr.persist(10, raw_array));
+  EXPECT_EQ(OB_SUCCESS, mgr.persist(11, raw_array));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, mgr.do_persist_tasks());
+  EXPECT_EQ(OB_SUCCESS, mgr.get_cursor(10, pkey, 10, result));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, mgr.get_cursor(11, pkey, 10, result));
+  mgr.destroy();
+  delete[] entries;
+}
+
+}  // end namespace unittest
+}  // end namespace oceanbase
+
+int main(int argc, char** argv)
+{
+  OB_LOGGER.set_file_name("test_ilog_mmap_index.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  CLOG_LOG(INFO, "begin unittest::test_ilog_mmap_index");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "lib/allocator/page_arena.h"
+#include "lib/container/ob_se_array.h"
+#include "observer/mysql/obmp_query.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::observer;
+
+class TestMergeInsertStmts : public ::testing::Test {
+public:
+  // a NULL ref_prefix means the query must not be split
+  void check_split(const char* query, const char* ref_prefix, const char* ref_rows)
+  {
+    ObString prefix;
+    ObString rows;
+    const bool is_split = ObMPQuery::split_insert_values(ObString::make_string(query), prefix, rows);
+    if (NULL == ref_prefix) {
+      EXPECT_FALSE(is_split) << query;
+    } else {
+      ASSERT_TRUE(is_split) << query;
+      EXPECT_EQ(ObString::make_string(ref_prefix), prefix) << query;
+      EXPECT_EQ(ObString::make_string(ref_rows), rows) << query;
+    }
+  }
+
+  // a NULL ref_sql means the queries must not be merged
+  void check_merge(const char* const* queries, const int64_t count, const char* ref_sql)
+  {
+    ObSEArray<ObString, 4> query_array;
+    ObString merged_sql;
+    bool is_merged = false;
+    for (int64_t i = 0; i < count; ++i) {
+      ASSERT_EQ(OB_SUCCESS, query_array.push_back(ObString::make_string(queries[i])));
+    }
+    ASSERT_EQ(OB_SUCCESS, ObMPQuery::merge_insert_stmts(query_array, allocator_, merged_sql, is_merged));
+    if (NULL == ref_sql) {
+      EXPECT_FALSE(is_merged) << queries[0];
+    } else {
+      ASSERT_TRUE(is_merged) << queries[0];
+      EXPECT_EQ(ObString::make_string(ref_sql), merged_sql);
+    }
+  }
+
+protected:
+  ObArenaAllocator allocator_;
+};
+
+TEST_F(TestMergeInsertStmts, split_insert_values)
+{
+  check_split("insert into t values (1, 'a')", "insert into t values", "(1, 'a')");
+  check_split("  INSERT INTO t(a, b) VALUES(1,2) ; ", "INSERT INTO t(a, b) VALUES", "(1,2)");
+  check_split("insert into t value (1)", "insert into t value", "(1)");
+  check_split("insert ignore into t partition (p0) values (1), (2)",
+      "insert ignore into t partition (p0) values",
+      "(1), (2)");
+  // parentheses and commas inside quotes or calls
+  check_split(
+      "insert into t values (1, '(x'), ('it''s', \")\")", "insert into t values", "(1, '(x'), ('it''s', \")\")");
+  check_split("insert into `values` values (f(1, (2)))", "insert into `values` values", "(f(1, (2)))");
+
+  // anything which may change its meaning once the rows are put together
+  check_split("insert into t values (1) on duplicate key update a = 1", NULL, NULL);
+  check_split("insert into t select * from s", NULL, NULL);
+  check_split("insert into t set a = 1", NULL, NULL);
+  check_split("insert /* hint */ into t values (1)", NULL, NULL);
+  check_split("insert into t values (1) -- c", NULL, NULL);
+  check_split("insert into t values (1) # c", NULL, NULL);
+  check_split("insert into t values (5--1)", NULL, NULL);
+  check_split("insert into t values ('a\\'b')", NULL, NULL);
+  check_split("insert into t values row(1)", NULL, NULL);
+
+  // not an insert or not a complete one
+  check_split("", NULL, NULL);
+  check_split("insert into t", NULL, NULL);
+  check_split("insert into t values", NULL, NULL);
+  check_split("insert into t values (1", NULL, NULL);
+  check_split("insert into t values (1), ", NULL, NULL);
+  check_split("insert into t values (1) (2)", NULL, NULL);
+  check_split("insert into t values ('abc)", NULL, NULL);
+  check_split("insertx into t values (1)", NULL, NULL);
+  check_split("replace into t values (1)", NULL, NULL);
+  check_split("update t set a = 1", NULL, NULL);
+}
+
+TEST_F(TestMergeInsertStmts, merge_insert_stmts)
+{
+  const char* same_table[] = {
+      "insert into t values (1)", "insert into t values (2, 'x')", " insert into t values (3),(4);"};
+  check_merge(same_table, ARRAYSIZEOF(same_table), "insert into t values (1),(2, 'x'),(3),(4)");
+
+  const char* single[] = {"insert into t values (1)"};
+  check_merge(single, ARRAYSIZEOF(single), NULL);
+  const char* other_table[] = {"insert into t values (1)", "insert into s values (2)"};
+  check_merge(other_table, ARRAYSIZEOF(other_table), NULL);
+  const char* other_text[] = {"insert into t values (1)", "INSERT into t values (2)"};
+  check_merge(other_text, ARRAYSIZEOF(other_text), NULL);
+  const char* with_update[] = {"insert into t values (1)", "update t set a = 1"};
+  check_merge(with_update, ARRAYSIZEOF(with_update), NULL);
+  const char* with_upsert[] = {"insert into t values (1)", "insert into t values (1) on duplicate key update a = 2"};
+  check_merge(with_upsert, ARRAYSIZEOF(with_upsert), NULL);
+}
+
+int main(int argc, char** argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "observer/mysql/ob_mysql_request_manager.h"
+#include "share/config/ob_server_config.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::obmysql;
+using namespace oceanbase::sql;
+
+class TestMySQLRequestManager : public ::testing::Test {
+public:
+  static const int64_t MEM_LIMIT = 64 * 1024 * 1024;
+  static const int64_t QUEUE_SIZE = 100000;
+
+  virtual void SetUp()
+  {
+    GCONF._sql_audit_sample_ratio.set_value("100");
+    // tenant 500 has no schema, the eliminate task does not query its memory limit
+    ASSERT_EQ(OB_SUCCESS, req_mgr_.init(OB_SERVER_TENANT_ID, MEM_LIMIT, QUEUE_SIZE));
+  }
+  virtual void TearDown()
+  {
+    req_mgr_.destroy();
+    GCONF._sql_audit_sample_ratio.set_value("100");
+  }
+
+  // trans_hash_ tags the record so the test can tell the records apart in queue
+  int record(const uint64_t tag, const int status = OB_SUCCESS, const int64_t elapsed_time = 0)
+  {
+    ObAuditRecordData audit_record;
+    audit_record.trans_hash_ = tag;
+    audit_record.status_ = status;
+    audit_record.exec_timestamp_.receive_ts_ = ObTimeUtility::current_time();
+    audit_record.exec_timestamp_.executor_end_ts_ = audit_record.exec_timestamp_.receive_ts_ + elapsed_time;
+    return req_mgr_.record_request(audit_record);
+  }
+
+  // checks that the published records carry their queue sequence as request id
+  void check_request_ids()
+  {
+    for (int64_t idx = req_mgr_.get_start_idx(); idx < req_mgr_.get_end_idx(); idx++) {
+      void* rec = NULL;
+      ObMySQLRequestManager::Ref ref;
+      ASSERT_EQ(OB_SUCCESS, req_mgr_.get(idx, rec, &ref));
+      ASSERT_EQ(idx, static_cast<ObMySQLRequestRecord*>(rec)->data_.request_id_);
+      req_mgr_.revert(&ref);
+    }
+  }
+
+protected:
+  ObMySQLRequestManager req_mgr_;
+};
+
+TEST_F(TestMySQLRequestManager, stage_and_flush)
+{
+  const int64_t staged_cnt = ObMySQLRequestManager::STAGE_BATCH_SIZE / 2;
+  // fewer records than a batch stay in stage until flushed
+  for (int64_t i = 0; i < staged_cnt; i++) {
+    ASSERT_EQ(OB_SUCCESS, record(i));
+  }
+  ASSERT_EQ(0, req_mgr_.get_size_used());
+  req_mgr_.flush_staged_records();
+  ASSERT_EQ(staged_cnt, req_mgr_.get_size_used());
+
+  // a full batch is published without flush
+  for (int64_t i = staged_cnt; i < staged_cnt + ObMySQLRequestManager::STAGE_BATCH_SIZE; i++) {
+    ASSERT_EQ(OB_SUCCESS, record(i));
+  }
+  ASSERT_EQ(staged_cnt + ObMySQLRequestManager::STAGE_BATCH_SIZE, req_mgr_.get_size_used());
+
+  // records of one thread are published in the order they are recorded
+  for (int64_t idx = req_mgr_.get_start_idx(); idx < req_mgr_.get_end_idx(); idx++) {
+    void* rec = NULL;
+    ObMySQLRequestManager::Ref ref;
+    ASSERT_EQ(OB_SUCCESS, req_mgr_.get(idx, rec, &ref));
+    ASSERT_EQ(static_cast<uint64_t>(idx - req_mgr_.get_start_idx()),
+        static_cast<ObMySQLRequestRecord*>(rec)->data_.trans_hash_);
+    req_mgr_.revert(&ref);
+  }
+  check_request_ids();
+
+  // nothing left in stage after clear
+  ASSERT_EQ(OB_SUCCESS, record(0));
+  req_mgr_.clear_queue();
+  ASSERT_EQ(0, req_mgr_.get_size_used());
+}
+
+TEST_F(TestMySQLRequestManager, stage_timeout)
+{
+  ASSERT_EQ(OB_SUCCESS, record(0));
+  ASSERT_EQ(0, req_mgr_.get_size_used());
+  ::usleep(ObMySQLRequestManager::MAX_STAGE_TIME);
+  // the next record of the slot publishes the records staged too long
+  ASSERT_EQ(OB_SUCCESS, record(1));
+  ASSERT_EQ(2, req_mgr_.get_size_used());
+}
+
+TEST_F(TestMySQLRequestManager, concurrent_stage)
+{
+  // more threads than the old fixed slot count
+  const int64_t thread_cnt = 80;
+  const int64_t record_cnt = 100;
+  std::vector<std::thread> threads;
+  for (int64_t t = 0; t < thread_cnt; t++) {
+    threads.push_back(std::thread([this, t, record_cnt]() {
+      for (int64_t i = 0; i < record_cnt; i++) {
+        ASSERT_EQ(OB_SUCCESS, record(t * record_cnt + i));
+      }
+    }));
+  }
+  for (int64_t t = 0; t < thread_cnt; t++) {
+    threads.at(t).join();
+  }
+  req_mgr_.flush_staged_records();
+  ASSERT_EQ(thread_cnt * record_cnt, req_mgr_.get_size_used());
+  check_request_ids();
+
+  // records of each thread keep their order
+  std::vector<int64_t> last_tag(thread_cnt, -1);
+  for (int64_t idx = req_mgr_.get_start_idx(); idx < req_mgr_.get_end_idx(); idx++) {
+    void* rec = NULL;
+    ObMySQLRequestManager::Ref ref;
+    ASSERT_EQ(OB_SUCCESS, req_mgr_.get(idx, rec, &ref));
+    const int64_t tag = static_cast<int64_t>(static_cast<ObMySQLRequestRecord*>(rec)->data_.trans_hash_);
+    req_mgr_.revert(&ref);
+    ASSERT_LT(last_tag.at(tag / record_cnt), tag);
+    last_tag.at(tag / record_cnt) = tag;
+  }
+}
+
+TEST_F(TestMySQLRequestManager, sample_ratio)
+{
+  const int64_t record_cnt = 1000;
+  const int64_t slow_time = GCONF.trace_log_slow_query_watermark;
+  GCONF._sql_audit_sample_ratio.set_value("10");
+  for (int64_t i = 0; i < record_cnt; i++) {
+    ASSERT_EQ(OB_SUCCESS, record(i));
+  }
+  req_mgr_.flush_staged_records();
+  ASSERT_EQ(record_cnt / 10, req_mgr_.get_size_used());
+
+  // failed and slow requests are always recorded
+  req_mgr_.clear_queue();
+  for (int64_t i = 0; i < record_cnt; i++) {
+    ASSERT_EQ(OB_SUCCESS, record(i, OB_ERR_UNEXPECTED));
+    ASSERT_EQ(OB_SUCCESS, record(i, OB_SUCCESS, slow_time));
+  }
+  req_mgr_.flush_staged_records();
+  ASSERT_EQ(2 * record_cnt, req_mgr_.get_size_used());
+
+  // sensitive requests are never recorded
+  req_mgr_.clear_queue();
+  GCONF._sql_audit_sample_ratio.set_value("100");
+  ObAuditRecordData audit_record;
+  ASSERT_EQ(OB_SUCCESS, req_mgr_.record_request(audit_record, true));
+  req_mgr_.flush_staged_records();
+  ASSERT_EQ(0, req_mgr_.get_size_used());
+}
+
+int main(int argc, char** argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,75 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "rootserver/ob_partition_disk_balancer.h"
+#include "rootserver/ob_balance_info.h"
+
+namespace oceanbase {
+using namespace common;
+using namespace rootserver::balancer;
+
+namespace rootserver {
+
+static const double TOLERANCE = 0.1;
+
+TEST(TestPartitionDiskBalancer, need_balance_iops)
+{
+  // an idle tenant is never balanced by read load
+  ASSERT_FALSE(UnitDiskBalanceStat::need_balance_iops(0, 0, TOLERANCE));
+  ASSERT_FALSE(UnitDiskBalanceStat::need_balance_iops(90, 10, TOLERANCE));
+  ASSERT_FALSE(UnitDiskBalanceStat::need_balance_iops(1000, 99.9, TOLERANCE));
+
+  // the busiest unit must exceed the average by the tolerance
+  ASSERT_FALSE(UnitDiskBalanceStat::need_balance_iops(100, 100, TOLERANCE));
+  ASSERT_FALSE(UnitDiskBalanceStat::need_balance_iops(1099, 1000, TOLERANCE));
+  ASSERT_TRUE(UnitDiskBalanceStat::need_balance_iops(1100, 1000, TOLERANCE));
+  ASSERT_TRUE(UnitDiskBalanceStat::need_balance_iops(2000, 1000, TOLERANCE));
+  ASSERT_TRUE(UnitDiskBalanceStat::need_balance_iops(
+      UnitDiskBalanceStat::MIN_BALANCE_AVG_IOPS * 2, UnitDiskBalanceStat::MIN_BALANCE_AVG_IOPS, TOLERANCE));
+}
+
+TEST(TestPartitionDiskBalancer, can_exchange_iops)
+{
+  // units at 1400 and 600 around an average of 1000, upper bound 1100
+  ASSERT_TRUE(DynamicAverageDiskBalancer::can_exchange_iops(300, 100, 1400, 600, 1000, TOLERANCE));
+  ASSERT_TRUE(DynamicAverageDiskBalancer::can_exchange_iops(300, 0, 1400, 600, 1000, TOLERANCE));
+
+  // too little load moved to be worth a migration
+  ASSERT_FALSE(DynamicAverageDiskBalancer::can_exchange_iops(149, 100, 1400, 600, 1000, TOLERANCE));
+  ASSERT_TRUE(DynamicAverageDiskBalancer::can_exchange_iops(
+      150, 150 - DynamicAverageDiskBalancer::MIN_EXCHANGE_IOPS, 1400, 600, 1000, TOLERANCE));
+  // swapping two partitions of similar load
+  ASSERT_FALSE(DynamicAverageDiskBalancer::can_exchange_iops(1000, 920, 1400, 600, 1000, TOLERANCE));
+
+  // the busy unit is within the tolerance or the idle unit is not below the average
+  ASSERT_FALSE(DynamicAverageDiskBalancer::can_exchange_iops(300, 100, 1100, 600, 1000, TOLERANCE));
+  ASSERT_FALSE(DynamicAverageDiskBalancer::can_exchange_iops(300, 100, 1400, 1000, 1000, TOLERANCE));
+
+  // the busy unit must stay above the average and the idle one below the upper bound,
+  // otherwise the next round swaps the partitions back
+  ASSERT_FALSE(DynamicAverageDiskBalancer::can_exchange_iops(500, 100, 1400, 600, 1000, TOLERANCE));
+  ASSERT_FALSE(DynamicAverageDiskBalancer::can_exchange_iops(300, 0, 1400, 800, 1000, TOLERANCE));
+  ASSERT_TRUE(DynamicAverageDiskBalancer::can_exchange_iops(299, 0, 1400, 800, 1000, TOLERANCE));
+}
+
+}  // end namespace rootserver
+}  // end namespace oceanbase
+
+int main(int argc, char** argv)
+{
+  system("rm -f test_partition_disk_balancer.log*");
+  OB_LOGGER.set_file_name("test_partition_disk_balancer.log", true, true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -868,6 +868,57 @@ TEST_F(TestSchemaMgr, assign_and_deep_copy)
   ASSERT_EQ(tenant_schema, *tenant);
 }
 
+TEST_F(TestSchemaMgr, assign_share_table_maps)
+{
+  ObSchemaMgr schema_mgr;
+  ObSimpleTenantSchema tenant_schema;
+  ObSimpleTableSchemaV2 table_schema;
+  ObSimpleSysVariableSchema sys_variable;
+
+  GEN_TENANT_SCHEMA(tenant_schema, 1, "sys_tenant", 0);
+  ASSERT_EQ(OB_SUCCESS, schema_mgr.add_tenant(tenant_schema));
+  GEN_SYS_VARIABLE_SCHEMA(sys_variable, 1, 0);
+  ASSERT_EQ(OB_SUCCESS, schema_mgr.sys_variable_mgr_.add_sys_variable(sys_variable));
+
+  const int64_t table_num = 2000;
+  ObArray<ObSimpleTableSchemaV2> table_schemas;
+  char table_name[50];
+  for (int64_t i = 1; i < table_num; ++i) {
+    snprintf(table_name, 50, "table%ld", i);
+    GEN_TABLE_SCHEMA(table_schema, 1, combine_id(1, 1), combine_id(1, i), table_name, USER_TABLE, 0);
+    table_schemas.push_back(table_schema);
+  }
+  ASSERT_EQ(OB_SUCCESS, schema_mgr.add_tables(table_schemas));
+  ObSchemaMgr new_mgr;
+  new_mgr.init();
+  ASSERT_EQ(OB_SUCCESS, new_mgr.assign(schema_mgr));
+  ASSERT_EQ(0, schema_mgr.table_id_map_.exclusive_shard_count());
+  ASSERT_EQ(0, new_mgr.table_name_map_.exclusive_shard_count());
+
+  // one more table only copies one shard of each map
+  GEN_TABLE_SCHEMA(table_schema, 1, combine_id(1, 1), combine_id(1, table_num), "new_table", USER_TABLE, 1);
+  ASSERT_EQ(OB_SUCCESS, schema_mgr.add_table(table_schema));
+  ASSERT_EQ(1, schema_mgr.table_id_map_.exclusive_shard_count());
+  ASSERT_EQ(1, schema_mgr.table_name_map_.exclusive_shard_count());
+  ASSERT_EQ(table_num, schema_mgr.table_id_map_.item_count());
+  ASSERT_EQ(table_num - 1, new_mgr.table_id_map_.item_count());
+  const ObSimpleTableSchemaV2* table = NULL;
+  ASSERT_EQ(OB_SUCCESS, schema_mgr.get_table_schema(combine_id(1, table_num), table));
+  ASSERT_TRUE(NULL != table);
+  ASSERT_EQ(OB_SUCCESS, new_mgr.get_table_schema(combine_id(1, table_num), table));
+  ASSERT_TRUE(NULL == table);
+  ASSERT_EQ(OB_SUCCESS, new_mgr.get_table_schema(combine_id(1, 1), table));
+  ASSERT_TRUE(NULL != table);
+
+  // dropping a table leaves the assigned mgr untouched as well
+  ASSERT_EQ(OB_SUCCESS, schema_mgr.del_table(ObTenantTableId(1, combine_id(1, 1))));
+  ASSERT_EQ(OB_SUCCESS, schema_mgr.get_table_schema(combine_id(1, 1), table));
+  ASSERT_TRUE(NULL == table);
+  ASSERT_EQ(OB_SUCCESS, new_mgr.get_table_schema(combine_id(1, 1), table));
+  ASSERT_TRUE(NULL != table);
+  ASSERT_EQ(table_num - 1, new_mgr.table_id_map_.item_count());
+}
+
 TEST_F(TestSchemaMgr, perf)
 {
   ObSchemaMgr schema_mgr;
@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "gtest/gtest.h"
+
+#include "lib/allocator/page_arena.h"
+#include "share/stat/ob_histogram_builder.h"
+
+using namespace oceanbase;
+using namespace common;
+
+// endpoint numbers are cumulative, the last one is the sample count
+static void check_buckets(const ObHistogram& histogram, const int64_t sample_cnt)
+{
+  const ObHistogram::Buckets& buckets = histogram.get_buckets();
+  ASSERT_TRUE(buckets.count() > 0);
+  for (int64_t i = 1; i < buckets.count(); ++i) {
+    ASSERT_LT(buckets.at(i - 1)->endpoint_num_, buckets.at(i)->endpoint_num_);
+    ASSERT_LT(buckets.at(i - 1)->endpoint_value_.get_int(), buckets.at(i)->endpoint_value_.get_int());
+  }
+  ASSERT_EQ(sample_cnt, buckets.at(buckets.count() - 1)->endpoint_num_);
+}
+
+TEST(ObHistogramBuilder, frequency)
+{
+  ObArenaAllocator allocator;
+  ObOptColumnStat stat(allocator);
+  ObHistogramBuilder builder;
+  ObObj value;
+  value.set_null();
+  ASSERT_EQ(OB_SUCCESS, builder.add_value(value));
+  for (int64_t i = 0; i < 1000; ++i) {
+    value.set_int(i % 10);
+    ASSERT_EQ(OB_SUCCESS, builder.add_value(value));
+  }
+  ASSERT_EQ(1000, builder.get_seen_count());
+  ASSERT_EQ(1000, builder.get_sample_count());
+  ASSERT_EQ(OB_SUCCESS, builder.build(254, 10, stat));
+  ASSERT_TRUE(NULL != stat.get_histogram());
+  const ObHistogram& histogram = *stat.get_histogram();
+  ASSERT_EQ(ObHistogram::Type::FREQUENCY, histogram.get_type());
+  ASSERT_EQ(10, histogram.get_buckets().count());
+  check_buckets(histogram, 1000);
+  for (int64_t i = 0; i < histogram.get_buckets().count(); ++i) {
+    ASSERT_EQ(100, histogram.get_buckets().at(i)->endpoint_repeat_count_);
+  }
+}
+
+TEST(ObHistogramBuilder, top_frequency)
+{
+  ObArenaAllocator allocator;
+  ObOptColumnStat stat(allocator);
+  ObHistogramBuilder builder;
+  ObObj value;
+  for (int64_t i = 0; i < 3000; ++i) {
+    value.set_int((i % 10) * 100);
+    ASSERT_EQ(OB_SUCCESS, builder.add_value(value));
+  }
+  for (int64_t i = 0; i < 20; ++i) {
+    value.set_int(i * 100 + 1);
+    ASSERT_EQ(OB_SUCCESS, builder.add_value(value));
+  }
+  ASSERT_EQ(ObHistogramBuilder::MAX_SAMPLE_COUNT, builder.get_sample_count());
+  ASSERT_EQ(OB_SUCCESS, builder.build(10, 30, stat));
+  ASSERT_TRUE(NULL != stat.get_histogram());
+  const ObHistogram& histogram = *stat.get_histogram();
+  ASSERT_EQ(ObHistogram::Type::TOP_FREQUENCY, histogram.get_type());
+  ASSERT_EQ(10, histogram.get_buckets().count());
+  for (int64_t i = 0; i < histogram.get_buckets().count(); ++i) {
+    ASSERT_EQ(0, histogram.get_buckets().at(i)->endpoint_value_.get_int() % 100);
+  }
+}
+
+TEST(ObHistogramBuilder, hybrid)
+{
+  ObArenaAllocator allocator;
+  ObOptColumnStat stat(allocator);
+  ObHistogramBuilder builder;
+  ObObj value;
+  for (int64_t i = 0; i < 100000; ++i) {
+    // one popular value and a uniform tail
+    value.set_int(0 == i % 4 ? 0 : i);
+    ASSERT_EQ(OB_SUCCESS, builder.add_value(value));
+  }
+  ASSERT_EQ(OB_SUCCESS, builder.build(32, 75001, stat));
+  ASSERT_TRUE(NULL != stat.get_histogram());
+  const ObHistogram& histogram = *stat.get_histogram();
+  ASSERT_EQ(ObHistogram::Type::HYBIRD, histogram.get_type());
+  ASSERT_TRUE(histogram.get_buckets().count() <= 32);
+  check_buckets(histogram, ObHistogramBuilder::MAX_SAMPLE_COUNT);
+  bool is_popular = false;
+  ASSERT_EQ(0, histogram.get_buckets().at(0)->endpoint_value_.get_int());
+  ASSERT_EQ(OB_SUCCESS, histogram.bucket_is_popular(*histogram.get_buckets().at(0), is_popular));
+  ASSERT_TRUE(is_popular);
+  ASSERT_GT(histogram.get_density(), 0);
+  ASSERT_LT(histogram.get_density(), 1.0 / 32);
+}
+
+TEST(ObHistogramBuilder, merge)
+{
+  ObHistogramBuilder left;
+  ObHistogramBuilder right;
+  ObObj value;
+  for (int64_t i = 0; i < 6000; ++i) {
+    value.set_int(i);
+    ASSERT_EQ(OB_SUCCESS, left.add_value(value));
+  }
+  for (int64_t i = 0; i < 2000; ++i) {
+    value.set_int(-i - 1);
+    ASSERT_EQ(OB_SUCCESS, right.add_value(value));
+  }
+  ASSERT_EQ(OB_SUCCESS, left.merge(right));
+  ASSERT_EQ(8000, left.get_seen_count());
+  ASSERT_EQ(ObHistogramBuilder::MAX_SAMPLE_COUNT, left.get_sample_count());
+  ASSERT_EQ(OB_INVALID_ARGUMENT, left.merge(left));
+
+  ObArenaAllocator allocator;
+  ObOptColumnStat stat(allocator);
+  int64_t negative_cnt = 0;
+  ASSERT_EQ(OB_SUCCESS, left.build(1024, 8000, stat));
+  ASSERT_EQ(ObHistogram::Type::HYBIRD, stat.get_histogram()->get_type());
+  const ObHistogram::Buckets& buckets = stat.get_histogram()->get_buckets();
+  for (int64_t i = 0; i < buckets.count(); ++i) {
+    if (buckets.at(i)->endpoint_value_.get_int() < 0) {
+      ++negative_cnt;
+    }
+  }
+  // right side owns a quarter of the values
+  ASSERT_GT(negative_cnt, buckets.count() / 8);
+  ASSERT_LT(negative_cnt, buckets.count() * 3 / 8);
+}
+
+int main(int argc, char** argv)
+{
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,360 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL
+
+#include <gtest/gtest.h>
+#include "lib/alloc/ob_malloc_allocator.h"
+#include "lib/number/ob_number_v2.h"
+#include "sql/ob_sql_init.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/aggregate/ob_aggregate_processor.h"
+
+namespace oceanbase {
+namespace sql {
+using namespace common;
+using namespace common::number;
+
+// SUM of number column is calculated in int64 scaled by 10^scale of the column,
+// test the conversion, the fallback to ObNumber and rollup of the scaled sum.
+class TestScaledNumberSum : public ::testing::Test {
+public:
+  typedef ObAggregateProcessor::AggrCell AggrCell;
+
+  TestScaledNumberSum() : eval_ctx_(exec_ctx_, eval_res_, eval_tmp_), processor_(eval_ctx_, aggr_infos_)
+  {}
+
+  virtual void SetUp() override
+  {
+    eval_ctx_.frames_ = static_cast<char**>(alloc_.alloc(sizeof(char*)));
+    ASSERT_TRUE(NULL != eval_ctx_.frames_);
+    eval_ctx_.frames_[0] = static_cast<char*>(alloc_.alloc(FRAME_SIZE));
+    ASSERT_TRUE(NULL != eval_ctx_.frames_[0]);
+    MEMSET(eval_ctx_.frames_[0], 0, FRAME_SIZE);
+    aggr_expr_.frame_idx_ = 0;
+    aggr_expr_.datum_off_ = 0;
+    aggr_expr_.eval_info_off_ = sizeof(ObDatum);
+    aggr_expr_.res_buf_off_ = sizeof(ObDatum) + sizeof(ObEvalInfo);
+    aggr_expr_.res_buf_len_ = ObNumber::MAX_BYTE_LEN;
+    aggr_info_.expr_ = &aggr_expr_;
+    aggr_info_.set_allocator(&alloc_);
+    ASSERT_EQ(OB_SUCCESS, aggr_info_.param_exprs_.init(1));
+    ASSERT_EQ(OB_SUCCESS, aggr_info_.param_exprs_.push_back(&param_expr_));
+    // DECIMAL(20, 2) column by default
+    init_aggr_info(T_FUN_SUM, 2);
+  }
+
+  void init_aggr_info(const ObExprOperatorType aggr_type, const int16_t scale)
+  {
+    aggr_expr_.type_ = aggr_type;
+    param_expr_.datum_meta_.type_ = ObNumberType;
+    param_expr_.datum_meta_.scale_ = scale;
+  }
+
+  bool to_scaled_int(const char* str, const int64_t scale, int64_t& value)
+  {
+    ObNumber nmb;
+    EXPECT_EQ(OB_SUCCESS, nmb.from(str, alloc_));
+    return ObAggregateProcessor::number_to_scaled_int(nmb, scale, value);
+  }
+
+  bool get_scale(int64_t& scale)
+  {
+    return ObAggregateProcessor::get_scaled_number_scale(aggr_info_, scale);
+  }
+
+  // add one row to group, the first row of group is prepared like the processor does
+  int add(AggrCell& aggr_cell, const char* str)
+  {
+    int ret = OB_SUCCESS;
+    ObNumber nmb;
+    ObDatum datum;
+    char* buf = NULL;
+    if (OB_FAIL(nmb.from(str, alloc_))) {
+      LOG_WARN("create number failed", K(ret), K(str));
+    } else if (OB_ISNULL(buf = static_cast<char*>(alloc_.alloc(ObNumber::MAX_BYTE_LEN)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("allocate memory failed", K(ret));
+    } else {
+      datum.ptr_ = buf;
+      datum.set_number(nmb);
+      if (0 == aggr_cell.get_row_count()) {
+        ret = processor_.prepare_add_calc(datum, aggr_cell, aggr_info_);
+      } else {
+        ret = processor_.add_calc(datum, aggr_cell, aggr_info_);
+      }
+      aggr_cell.inc_row_count();
+    }
+    return ret;
+  }
+
+  int flush(AggrCell& aggr_cell)
+  {
+    return processor_.flush_scaled_number_sum(aggr_cell, aggr_info_);
+  }
+
+  int rollup(AggrCell& aggr_cell, AggrCell& rollup_cell)
+  {
+    return processor_.rollup_aggregation(aggr_cell, rollup_cell, NULL, aggr_info_);
+  }
+
+  void check_sum(AggrCell& aggr_cell, const char* expect)
+  {
+    ObNumber expect_nmb;
+    ASSERT_EQ(OB_SUCCESS, expect_nmb.from(expect, alloc_));
+    ASSERT_EQ(OB_SUCCESS, aggr_cell.collect_result(ObNumberTC, eval_ctx_, aggr_info_));
+    ObDatum& result = aggr_expr_.locate_expr_datum(eval_ctx_);
+    ASSERT_FALSE(result.is_null());
+    ObNumber result_nmb(result.get_number());
+    ASSERT_EQ(0, result_nmb.compare(expect_nmb)) << "result: " << result_nmb.format() << " expect: " << expect;
+  }
+
+protected:
+  static const int64_t FRAME_SIZE = 4096;
+
+  ObArenaAllocator alloc_;
+  ObExecContext exec_ctx_;
+  ObArenaAllocator eval_res_;
+  ObArenaAllocator eval_tmp_;
+  ObEvalCtx eval_ctx_;
+  ObExpr param_expr_;
+  ObExpr aggr_expr_;
+  ObAggrInfo aggr_info_;
+  ObSEArray<ObAggrInfo, 1> aggr_infos_;
+  ObAggregateProcessor processor_;
+};
+
+TEST_F(TestScaledNumberSum, number_to_scaled_int)
+{
+  int64_t value = 0;
+  ASSERT_TRUE(to_scaled_int("0", 2, value));
+  ASSERT_EQ(0, value);
+  ASSERT_TRUE(to_scaled_int("1.25", 2, value));
+  ASSERT_EQ(125, value);
+  ASSERT_TRUE(to_scaled_int("0.5", 2, value));
+  ASSERT_EQ(50, value);
+  ASSERT_TRUE(to_scaled_int("3", 2, value));
+  ASSERT_EQ(300, value);
+  ASSERT_TRUE(to_scaled_int("-0.07", 2, value));
+  ASSERT_EQ(-7, value);
+  ASSERT_TRUE(to_scaled_int("-1.25", 2, value));
+  ASSERT_EQ(-125, value);
+  // more than one digit of ObNumber::BASE in integer part
+  ASSERT_TRUE(to_scaled_int("1000000000.5", 2, value));
+  ASSERT_EQ(100000000050, value);
+  ASSERT_TRUE(to_scaled_int("-1000000000.5", 2, value));
+  ASSERT_EQ(-100000000050, value);
+
+  // more decimal digits than scale
+  ASSERT_FALSE(to_scaled_int("0.001", 2, value));
+  ASSERT_FALSE(to_scaled_int("1.255", 2, value));
+  ASSERT_FALSE(to_scaled_int("-1.255", 2, value));
+  ASSERT_FALSE(to_scaled_int("1.5", 0, value));
+  ASSERT_TRUE(to_scaled_int("12", 0, value));
+  ASSERT_EQ(12, value);
+
+  // decimal part in the second digit of ObNumber::BASE
+  ASSERT_TRUE(to_scaled_int("0.000000001", 9, value));
+  ASSERT_EQ(1, value);
+  ASSERT_TRUE(to_scaled_int("1.123456789", 9, value));
+  ASSERT_EQ(1123456789, value);
+  ASSERT_FALSE(to_scaled_int("1.0000000001", 9, value));
+
+  // value * 10^scale overflows int64
+  ASSERT_TRUE(to_scaled_int("92233720368547757", 2, value));
+  ASSERT_EQ(9223372036854775700, value);
+  ASSERT_TRUE(to_scaled_int("-92233720368547757", 2, value));
+  ASSERT_EQ(-9223372036854775700, value);
+  ASSERT_FALSE(to_scaled_int("92233720368547758", 2, value));
+  ASSERT_FALSE(to_scaled_int("-92233720368547758", 2, value));
+  ASSERT_FALSE(to_scaled_int("100000000000000000000", 0, value));
+
+  // scale of column out of range
+  int64_t scale = 0;
+  ASSERT_TRUE(get_scale(scale));
+  ASSERT_EQ(2, scale);
+  init_aggr_info(T_FUN_SUM, -1);
+  ASSERT_FALSE(get_scale(scale));
+  init_aggr_info(T_FUN_SUM, 10);
+  ASSERT_FALSE(get_scale(scale));
+}
+
+TEST_F(TestScaledNumberSum, mixed_scale)
+{
+  AggrCell aggr_cell;
+  ASSERT_EQ(OB_SUCCESS, add(aggr_cell, "1.5"));
+  ASSERT_EQ(OB_SUCCESS, add(aggr_cell, "2.25"));
+  ASSERT_EQ(OB_SUCCESS, add(aggr_cell, "3"));
+  ASSERT_TRUE(aggr_cell.is_tiny_num_used());
+  ASSERT_TRUE(aggr_cell.get_iter_result().is_null());
+  ASSERT_EQ(675, aggr_cell.get_tiny_num_int());
+
+  // value with more decimal digits than the column is summed in ObNumber
+  ASSERT_EQ(OB_SUCCESS, add(aggr_cell, "0.001"));
+  ASSERT_EQ(OB_SUCCESS, add(aggr_cell, "1.01"));
+  ASSERT_FALSE(aggr_cell.get_iter_result().is_null());
+  ASSERT_EQ(776, aggr_cell.get_tiny_num_int());
+  check_sum(aggr_cell, "7.761");
+
+  ASSERT_EQ(OB_SUCCESS, flush(aggr_cell));
+  ASSERT_EQ(0, aggr_cell.get_tiny_num_int());
+  check_sum(aggr_cell, "7.761");
+
+  // first row can not be scaled
+  AggrCell other_cell;
+  ASSERT_EQ(OB_SUCCESS, add(other_cell, "0.125"));
+  ASSERT_FALSE(other_cell.is_tiny_num_used());
+  ASSERT_EQ(OB_SUCCESS, add(other_cell, "1.5"));
+  ASSERT_EQ(OB_SUCCESS, add(other_cell, "0.0001"));
+  ASSERT_TRUE(other_cell.is_tiny_num_used());
+  check_sum(other_cell, "1.6251");
+}
+
+TEST_F(TestScaledNumberSum, negative)
+{
+  AggrCell aggr_cell;
+  ASSERT_EQ(OB_SUCCESS, add(aggr_cell, "-1.25"));
+  ASSERT_EQ(OB_SUCCESS, add(aggr_cell, "-2.5"));
+  ASSERT_EQ(OB_SUCCESS, add(aggr_cell, "0.75"));
+  ASSERT_EQ(-300, aggr_cell.get_tiny_num_int());
+  check_sum(aggr_cell, "-3");
+  ASSERT_EQ(OB_SUCCESS, add(aggr_cell, "-0.001"));
+  check_sum(aggr_cell, "-3.001");
+  ASSERT_EQ(OB_SUCCESS, add(aggr_cell, "5"));
+  check_sum(aggr_cell, "1.999");
+
+  // scaled sum cancels out to zero, result is 0 instead of NULL
+  AggrCell zero_cell;
+  ASSERT_EQ(OB_SUCCESS, add(zero_cell, "1.00"));
+  ASSERT_EQ(OB_SUCCESS, add(zero_cell, "-1.00"));
+  ASSERT_TRUE(zero_cell.is_tiny_num_used());
+  ASSERT_EQ(0, zero_cell.get_tiny_num_int());
+  ASSERT_EQ(OB_SUCCESS, flush(zero_cell));
+  check_sum(zero_cell, "0");
+}
+
+TEST_F(TestScaledNumberSum, overflow)
+{
+  AggrCell aggr_cell;
+  ASSERT_EQ(OB_SUCCESS, add(aggr_cell, "92233720368547757"));
+  ASSERT_EQ(OB_SUCCESS, add(aggr_cell, "0.01"));
+  ASSERT_TRUE(aggr_cell.get_iter_result().is_null());
+  ASSERT_EQ(9223372036854775701, aggr_cell.get_tiny_num_int());
+  // int64 overflow, the scaled sum is moved to ObNumber
+  ASSERT_EQ(OB_SUCCESS, add(aggr_cell, "1.08"));
+  ASSERT_FALSE(aggr_cell.get_iter_result().is_null());
+  ASSERT_EQ(108, aggr_cell.get_tiny_num_int());
+  check_sum(aggr_cell, "92233720368547758.09");
+  ASSERT_EQ(OB_SUCCESS, add(aggr_cell, "92233720368547757"));
+  ASSERT_EQ(9223372036854775700, aggr_cell.get_tiny_num_int());
+  check_sum(aggr_cell, "184467440737095516.17");
+  // too large to be scaled
+  ASSERT_EQ(OB_SUCCESS, add(aggr_cell, "92233720368547758"));
+  check_sum(aggr_cell, "276701161105643274.17");
+
+  AggrCell negative_cell;
+  ASSERT_EQ(OB_SUCCESS, add(negative_cell, "-92233720368547757"));
+  ASSERT_EQ(OB_SUCCESS, add(negative_cell, "-92233720368547757"));
+  ASSERT_EQ(-9223372036854775700, negative_cell.get_tiny_num_int());
+  // sum reaches INT64_MIN without overflow
+  ASSERT_EQ(OB_SUCCESS, add(negative_cell, "-1.08"));
+  ASSERT_EQ(INT64_MIN, negative_cell.get_tiny_num_int());
+  check_sum(negative_cell, "-184467440737095515.08");
+  ASSERT_EQ(OB_SUCCESS, add(negative_cell, "-0.01"));
+  ASSERT_EQ(-1, negative_cell.get_tiny_num_int());
+  check_sum(negative_cell, "-184467440737095515.09");
+}
+
+TEST_F(TestScaledNumberSum, rollup)
+{
+  AggrCell cells[3];
+  AggrCell rollup_cell;
+  ASSERT_EQ(OB_SUCCESS, add(cells[0], "1.25"));
+  ASSERT_EQ(OB_SUCCESS, add(cells[0], "2.5"));
+  ASSERT_EQ(OB_SUCCESS, add(cells[1], "0.001"));
+  ASSERT_EQ(OB_SUCCESS, add(cells[1], "-1.25"));
+  ASSERT_EQ(OB_SUCCESS, add(cells[2], "1.00"));
+  ASSERT_EQ(OB_SUCCESS, add(cells[2], "-1.00"));
+  for (int64_t i = 0; i < 3; i++) {
+    ASSERT_EQ(OB_SUCCESS, rollup(cells[i], rollup_cell));
+  }
+  check_sum(rollup_cell, "2.501");
+  // rollup does not change the group results
+  check_sum(cells[0], "3.75");
+  check_sum(cells[1], "-1.249");
+  check_sum(cells[2], "0");
+
+  // only groups with zero scaled sum
+  AggrCell zero_rollup_cell;
+  ASSERT_EQ(OB_SUCCESS, rollup(cells[2], zero_rollup_cell));
+  ASSERT_EQ(OB_SUCCESS, rollup(cells[2], zero_rollup_cell));
+  check_sum(zero_rollup_cell, "0");
+
+  // scaled sum of rollup overflows int64
+  AggrCell big_cells[2];
+  AggrCell big_rollup_cell;
+  ASSERT_EQ(OB_SUCCESS, add(big_cells[0], "92233720368547757"));
+  ASSERT_EQ(OB_SUCCESS, add(big_cells[1], "92233720368547757"));
+  ASSERT_EQ(OB_SUCCESS, add(big_cells[1], "0.05"));
+  ASSERT_EQ(OB_SUCCESS, rollup(big_cells[0], big_rollup_cell));
+  ASSERT_EQ(OB_SUCCESS, rollup(big_cells[1], big_rollup_cell));
+  ASSERT_FALSE(big_rollup_cell.get_iter_result().is_null());
+  check_sum(big_rollup_cell, "184467440737095514.05");
+}
+
+TEST_F(TestScaledNumberSum, avg)
+{
+  // AVG of DECIMAL(10, 2) column, sum is divided by row count with 4 more decimal digits
+  init_aggr_info(T_FUN_AVG, 2);
+  AggrCell cells[2];
+  AggrCell rollup_cell;
+  ASSERT_EQ(OB_SUCCESS, add(cells[0], "1.10"));
+  ASSERT_EQ(OB_SUCCESS, add(cells[0], "2.25"));
+  ASSERT_EQ(OB_SUCCESS, add(cells[0], "3.30"));
+  ASSERT_EQ(OB_SUCCESS, add(cells[1], "-0.01"));
+  ASSERT_EQ(OB_SUCCESS, add(cells[1], "0.01"));
+  ASSERT_EQ(OB_SUCCESS, rollup(cells[0], rollup_cell));
+  ASSERT_EQ(OB_SUCCESS, rollup(cells[1], rollup_cell));
+  ASSERT_EQ(3, cells[0].get_row_count());
+  ASSERT_EQ(5, rollup_cell.get_row_count());
+  check_sum(cells[0], "6.65");
+  check_sum(cells[1], "0");
+  check_sum(rollup_cell, "6.65");
+
+  ObNumber sum_nmb(aggr_expr_.locate_expr_datum(eval_ctx_).get_number());
+  ObNumber count_nmb;
+  ObNumber avg_nmb;
+  ObNumber expect_nmb;
+  ASSERT_EQ(OB_SUCCESS, count_nmb.from(rollup_cell.get_row_count(), alloc_));
+  ASSERT_EQ(OB_SUCCESS, sum_nmb.div_v3(count_nmb, avg_nmb, alloc_));
+  ASSERT_EQ(OB_SUCCESS, avg_nmb.round(6));
+  ASSERT_EQ(OB_SUCCESS, expect_nmb.from("1.33", alloc_));
+  ASSERT_EQ(0, avg_nmb.compare(expect_nmb));
+}
+
+}  // end namespace sql
+}  // end namespace oceanbase
+
+int main(int argc, char** argv)
+{
+  oceanbase::sql::init_sql_factories();
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  // aggregate processor allocates from work area of server tenant
+  oceanbase::lib::ObMallocAllocator* malloc_allocator = oceanbase::lib::ObMallocAllocator::get_instance();
+  if (oceanbase::common::OB_SUCCESS !=
+      malloc_allocator->create_tenant_ctx_allocator(
+          oceanbase::common::OB_SERVER_TENANT_ID, oceanbase::common::ObCtxIds::WORK_AREA)) {
+    return -1;
+  }
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "sql/engine/expr/ob_expr_regexp_context.h"
+#undef private
+#include "lib/allocator/page_arena.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+class ObExprRegexContextTest : public ::testing::Test {
+public:
+  ObExprRegexContextTest();
+  virtual ~ObExprRegexContextTest();
+  virtual void SetUp();
+  virtual void TearDown();
+
+private:
+  // disallow copy
+  ObExprRegexContextTest(const ObExprRegexContextTest& other);
+  ObExprRegexContextTest& operator=(const ObExprRegexContextTest& other);
+
+protected:
+  // data members
+};
+
+ObExprRegexContextTest::ObExprRegexContextTest()
+{}
+
+ObExprRegexContextTest::~ObExprRegexContextTest()
+{}
+
+void ObExprRegexContextTest::SetUp()
+{}
+
+void ObExprRegexContextTest::TearDown()
+{}
+
+// extract the required literal of pattern and check it, an empty ref_literal means none
+#define L(pattern, cflags, ref_literal, ref_icase)                                           \
+  do {                                                                                     \
+    ObExprRegexContext ctx;                                                                \
+    ctx.extract_required_literal(ObString::make_string(pattern), (cflags));                \
+    const ObString literal(ctx.literal_len_, static_cast<const char*>(ctx.literal_));      \
+    EXPECT_EQ(ObString::make_string(ref_literal), literal) << pattern;                     \
+    EXPECT_EQ(ref_icase, ctx.literal_icase_) << pattern;                                   \
+  } while (0)
+// match through the regex context directly, OB_REG_ICASE is what a _ci collation turns on
+#define M(text, pattern, cflags, ref_value)                                             \
+  do {                                                                                  \
+    ObExprRegexContext ctx;                                                             \
+    bool is_match = !(ref_value);                                                       \
+    const int flags = OB_REG_EXTENDED | OB_REG_NOSUB | (cflags);                        \
+    ASSERT_EQ(OB_SUCCESS, ctx.init(ObString::make_string(pattern), flags, buf, false)); \
+    ASSERT_EQ(OB_SUCCESS, ctx.match(ObString::make_string(text), 0, is_match, buf));    \
+    EXPECT_EQ(ref_value, is_match);                                                     \
+  } while (0)
+
+TEST_F(ObExprRegexContextTest, extract_required_literal_test)
+{
+  L("hello", 0, "hello", false);
+  L("^hello$", 0, "hello", false);
+  // the longest run wins, the first one on a tie
+  L("ab.cde.fg", 0, "cde", false);
+  L("hello.*world", 0, "hello", false);
+  // groups are skipped
+  L("ab(cdef)gh", 0, "ab", false);
+  L("(abc)", 0, "", false);
+  // the char before ?, * or a bound is optional
+  L("abc?d", 0, "ab", false);
+  L("abc*d", 0, "ab", false);
+  L("abc{0,2}d", 0, "ab", false);
+  L("abc+", 0, "abc", false);
+  L("a?", 0, "", false);
+  // brackets and escapes end a run
+  L("a[]]c", 0, "a", false);
+  L("xy[[:alpha:]]]z", 0, "xy", false);
+  L("ab\\d.cde", 0, "cde", false);
+  L("a\\x41bc", 0, "a", false);
+  // nothing is required with alternation, directors or embedded options
+  L("xyz|abc", 0, "", false);
+  L("***=abc", 0, "", false);
+  L("(?i)abc", 0, "", false);
+  L("abc", OB_REG_QUOTE, "", false);
+  L("abc", OB_REG_EXPANDED, "", false);
+  L("", 0, "", false);
+  // case insensitive literal is kept in lower case
+  L("HeLLo", OB_REG_ICASE, "hello", true);
+  L("123", OB_REG_ICASE, "123", false);
+  // a long literal is truncated
+  L("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+      0,
+      "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+      false);
+}
+
+TEST_F(ObExprRegexContextTest, may_match_test)
+{
+  ObExprRegexContext ctx;
+  ASSERT_TRUE(ctx.may_match(ObString::make_string("")));
+  ASSERT_TRUE(ctx.may_match(ObString::make_string("anything")));
+
+  ctx.extract_required_literal(ObString::make_string("hello"), 0);
+  ASSERT_TRUE(ctx.may_match(ObString::make_string("hello")));
+  ASSERT_TRUE(ctx.may_match(ObString::make_string("say hello world")));
+  ASSERT_FALSE(ctx.may_match(ObString::make_string("hell")));
+  ASSERT_FALSE(ctx.may_match(ObString::make_string("HELLO")));
+  ASSERT_TRUE(ctx.may_match(ObString::make_string("helo hello")));
+  ASSERT_FALSE(ctx.may_match(ObString::make_string("")));
+
+  ctx.extract_required_literal(ObString::make_string("hello"), OB_REG_ICASE);
+  ASSERT_TRUE(ctx.may_match(ObString::make_string("HELLO")));
+  ASSERT_TRUE(ctx.may_match(ObString::make_string("xHeLLo")));
+  ASSERT_TRUE(ctx.may_match(ObString::make_string("hhello")));
+  ASSERT_FALSE(ctx.may_match(ObString::make_string("hxllo")));
+  // non ascii text may fold to the literal, never rejected
+  ASSERT_TRUE(ctx.may_match(ObString::make_string("K\xc3\xb6ln")));
+}
+
+// patterns whose required literal is extracted to reject the text early, a text which
+// matches must never be rejected
+TEST_F(ObExprRegexContextTest, literal_prefilter_test)
+{
+  ObArenaAllocator buf;
+
+  // alternation requires no literal
+  M("abc", "xyz|abc", 0, true);
+  M("abd", "xyz|abc", 0, false);
+  M("foo error", "warn|error", 0, true);
+  M("info", "warn|error", 0, false);
+  M("ab", "(c|d)|ab", 0, true);
+  M("abc", "ab(x|c)", 0, true);
+
+  // the char before ?, * or a bound with zero repeat is optional
+  M("abd", "abc?d", 0, true);
+  M("abd", "abc*d", 0, true);
+  M("abcccd", "abc*d", 0, true);
+  M("abd", "abc{0,2}d", 0, true);
+  M("abccd", "abc{0,2}d", 0, true);
+  M("abcccd", "abc{0,2}d", 0, false);
+  M("abd", "abc{1,2}d", 0, false);
+  M("ab", "abc?", 0, true);
+  M("xy", "abc?|xy", 0, true);
+
+  // brackets holding ] or a char class
+  M("a]c", "a[]]c", 0, true);
+  M("x]c", "x[]a]c", 0, true);
+  M("acb", "a[^]]b", 0, true);
+  M("a]b", "a[^]]b", 0, false);
+  M("a1b", "a[[:digit:]]b", 0, true);
+  M("a:b", "a[[:digit:]]b", 0, false);
+  M("xa]y", "x[[:alpha:]]]y", 0, true);
+  M("xay", "x[[:alpha:]]]y", 0, false);
+
+  // escapes are not literals
+  M("a1b", "a\\db", 0, true);
+  M("axb", "a\\db", 0, false);
+  M("a b", "a\\sb", 0, true);
+  M("ZAZ", "Z\\x41Z", 0, true);
+  M("Z41Z", "Z\\x41Z", 0, false);
+  M("<a> b", "<a>\\s*b", 0, true);
+
+  // embedded options and directors
+  M("ABC", "(?i)abc", 0, true);
+  M("abc", "(?i)xbc", 0, false);
+  M("ab", "(?i)AB|x", 0, true);
+  M("ABC", "(?i)a(b|c)c", 0, true);
+  M("xabcx", "***=a.c", 0, false);
+  M("a.c", "***=a.c", 0, true);
+  M("ABC", "***:(?i)abc", 0, true);
+
+  // case sensitive on non ascii text
+  M("K\xc3\xb6ln", "k\xc3\xb6ln", 0, false);
+  M("K\xc3\xb6ln", "K\xc3\xb6ln", 0, true);
+
+  // case insensitive on ascii text
+  M("HELLO World", "hello", OB_REG_ICASE, true);
+  M("xHeLLo", "hello", OB_REG_ICASE, true);
+  M("hxllo", "hello", OB_REG_ICASE, false);
+  M("xKelvin", "kelv.n", OB_REG_ICASE, true);
+  M("abc", "(?c)ABC", OB_REG_ICASE, false);
+
+  // case insensitive on non ascii text
+  M("Gr\xc3\xbc\xc3\x9f" "e AUS K\xc3\xb6ln", "aus", OB_REG_ICASE, true);
+  M("Gr\xc3\xbc\xc3\x9f" "e AUS K\xc3\xb6ln", "k\xc3\xb6ln", OB_REG_ICASE, true);
+  M("Gr\xc3\xbc\xc3\x9f" "e AUS K\xc3\xb6ln", "kxln", OB_REG_ICASE, false);
+  M("K\xc3\xb6ln", "K.LN", OB_REG_ICASE, true);
+}
+
+int main(int argc, char** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
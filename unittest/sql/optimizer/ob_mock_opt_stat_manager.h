@@ -340,6 +340,12 @@ public:
     handle.stat_ = &cstat_;
     return OB_SUCCESS;
   }
+  virtual int get_column_stat_from_cache(const ObOptColumnStat::Key& key, ObOptColumnStatHandle& handle)
+  {
+    UNUSED(key);
+    handle.stat_ = &cstat_;
+    return OB_SUCCESS;
+  }
   virtual int load_column_stat_and_put_cache(const ObOptColumnStat::Key& key, ObOptColumnStatHandle& handle)
   {
     UNUSED(key);
@@ -202,6 +202,56 @@ TEST(TestObQueryEngine, smoke_test)
   test_scan(5, false, 5, false);
 }
 
+TEST(TestObQueryEngine, prefetch)
+{
+  static const int64_t R_COUNT = 64;
+
+  int ret = OB_SUCCESS;
+  ObModAllocator allocator;
+  ObQueryEngine qe(allocator);
+  ObMemtableKey* mtk[R_COUNT];
+  ObMvccTransNode tdn[R_COUNT];
+  ObMvccRow mtv[R_COUNT];
+
+  ret = qe.init(1);
+  EXPECT_EQ(OB_SUCCESS, ret);
+  for (int64_t i = 0; i < R_COUNT; i++) {
+    INIT_MTK(allocator, mtk[i], 1000, V("aaaa", 4), I(i));
+    mtv[i].list_head_ = &tdn[i];
+  }
+
+  // prefetch on a missing table or an empty hash allocates nothing
+  qe.prefetch(1000, mtk[0]->get_rowkey(), false);
+  qe.prefetch(1000, mtk[0]->get_rowkey(), true);
+  qe.prefetch(1000, nullptr, true);
+  EXPECT_EQ(0, qe.hash_alloc_memory());
+
+  for (int64_t i = 0; i < R_COUNT; i += 2) {
+    ret = qe.set(mtk[i], &mtv[i]);
+    EXPECT_EQ(OB_SUCCESS, ret);
+  }
+  const int64_t alloc_memory = qe.hash_alloc_memory();
+  for (int64_t i = 0; i < R_COUNT; i++) {
+    qe.prefetch(1000, mtk[i]->get_rowkey(), false);
+    qe.prefetch(1000, mtk[i]->get_rowkey(), true);
+    qe.prefetch(1001, mtk[i]->get_rowkey(), true);
+  }
+  EXPECT_EQ(alloc_memory, qe.hash_alloc_memory());
+
+  // prefetch is only a hint, results of get are not affected
+  for (int64_t i = 0; i < R_COUNT; i++) {
+    ObMemtableKey t;
+    ObMvccRow* v = nullptr;
+    ret = qe.get(mtk[i], v, &t);
+    if (0 == i % 2) {
+      EXPECT_EQ(OB_SUCCESS, ret);
+      EXPECT_EQ(&mtv[i], v);
+    } else {
+      EXPECT_EQ(OB_ENTRY_NOT_EXIST, ret);
+    }
+  }
+}
+
 }  // namespace unittest
 }  // namespace oceanbase
 
@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include "lib/container/ob_array_iterator.h"
+#include "storage/ob_partition_scheduler.h"
+#include "storage/ob_table_store_stat_mgr.h"
+
+namespace oceanbase {
+using namespace common;
+using namespace storage;
+
+namespace unittest {
+
+static ObMinorMergeReadAmpInfo make_info(
+    const int64_t priority_idx, const int64_t bf_miss_cnt, const int64_t minor_table_cnt, const int64_t size_mb)
+{
+  ObMinorMergeReadAmpInfo info;
+  info.priority_idx_ = priority_idx;
+  info.bf_miss_cnt_ = bf_miss_cnt;
+  info.minor_table_cnt_ = minor_table_cnt;
+  info.minor_table_size_ = size_mb << 20;
+  info.calc_score();
+  return info;
+}
+
+TEST(TestMinorMergeReadAmp, bf_miss_cnt)
+{
+  ObTableStoreStat stat;
+  ASSERT_EQ(0, ObMinorMergeReadAmpInfo::get_bf_miss_cnt(stat));
+
+  // empty reads without bloom filter probes do not count
+  stat.get_row_.empty_read_cnt_ = 100;
+  stat.scan_row_.empty_read_cnt_ = 100;
+  ASSERT_EQ(0, ObMinorMergeReadAmpInfo::get_bf_miss_cnt(stat));
+
+  stat.bf_access_cnt_ = 100;
+  stat.bf_filter_cnt_ = 30;
+  ASSERT_EQ(70, ObMinorMergeReadAmpInfo::get_bf_miss_cnt(stat));
+
+  // the counters are updated without lock and may be seen out of order
+  stat.bf_filter_cnt_ = 101;
+  ASSERT_EQ(0, ObMinorMergeReadAmpInfo::get_bf_miss_cnt(stat));
+}
+
+TEST(TestMinorMergeReadAmp, bf_miss_delta)
+{
+  ASSERT_EQ(0, ObMinorMergeReadAmpInfo::get_bf_miss_delta(0, 0));
+  ASSERT_EQ(0, ObMinorMergeReadAmpInfo::get_bf_miss_delta(50, 50));
+  ASSERT_EQ(30, ObMinorMergeReadAmpInfo::get_bf_miss_delta(80, 50));
+  // stat evicted and recreated since the last scan
+  ASSERT_EQ(20, ObMinorMergeReadAmpInfo::get_bf_miss_delta(20, 50));
+  ASSERT_EQ(0, ObMinorMergeReadAmpInfo::get_bf_miss_delta(0, 50));
+}
+
+TEST(TestMinorMergeReadAmp, score)
+{
+  // nothing to save with at most one minor sstable
+  ASSERT_EQ(0, make_info(0, 1000, 0, 10).score_);
+  ASSERT_EQ(0, make_info(0, 1000, 1, 10).score_);
+  ASSERT_EQ(0, make_info(0, 0, 4, 10).score_);
+
+  // 4 minor sstables, 3 of 4 probes saved, 10MB rewritten
+  ASSERT_DOUBLE_EQ(75.0, make_info(0, 1000, 4, 10).score_);
+  // small sstables are counted as 1MB
+  ASSERT_DOUBLE_EQ(500.0, make_info(0, 1000, 2, 0).score_);
+  // more minor sstables save more probes
+  ASSERT_GT(make_info(0, 1000, 8, 10).score_, make_info(0, 1000, 2, 10).score_);
+  // bigger sstables cost more to rewrite
+  ASSERT_GT(make_info(0, 1000, 4, 10).score_, make_info(0, 1000, 4, 100).score_);
+}
+
+TEST(TestMinorMergeReadAmp, order)
+{
+  ObArray<ObMinorMergeReadAmpInfo> infos;
+  ASSERT_EQ(OB_SUCCESS, infos.push_back(make_info(0, 0, 0, 0)));
+  ASSERT_EQ(OB_SUCCESS, infos.push_back(make_info(1, 1000, 4, 10)));
+  ASSERT_EQ(OB_SUCCESS, infos.push_back(make_info(2, 0, 5, 10)));
+  ASSERT_EQ(OB_SUCCESS, infos.push_back(make_info(3, 1000, 2, 10)));
+  ASSERT_EQ(OB_SUCCESS, infos.push_back(make_info(4, 1000, 4, 10)));
+  ASSERT_EQ(OB_SUCCESS, infos.push_back(make_info(5, 10000, 1, 1)));
+  std::sort(infos.begin(), infos.end(), ObMinorMergeReadAmpCompare());
+
+  // highest score first, equal scores keep the memtable priority order
+  ASSERT_EQ(1, infos.at(0).priority_idx_);
+  ASSERT_EQ(4, infos.at(1).priority_idx_);
+  ASSERT_EQ(3, infos.at(2).priority_idx_);
+  // partitions without read amplification follow in the memtable priority order
+  ASSERT_EQ(0, infos.at(3).priority_idx_);
+  ASSERT_EQ(2, infos.at(4).priority_idx_);
+  ASSERT_EQ(5, infos.at(5).priority_idx_);
+}
+
+}  // end namespace unittest
+}  // end namespace oceanbase
+
+int main(int argc, char** argv)
+{
+  system("rm -f test_minor_merge_read_amp.log*");
+  OB_LOGGER.set_file_name("test_minor_merge_read_amp.log", true, true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
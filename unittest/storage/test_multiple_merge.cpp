@@ -13,8 +13,11 @@
 #include <gtest/gtest.h>
 #define private public
 #include "storage/ob_multiple_merge.h"
+#include "storage/ob_multiple_scan_merge_impl.h"
 #include "storage/ob_sstable.h"
+#include "storage/memtable/ob_memtable_context.h"
 #undef private
+#include "mockcontainer/mock_ob_iterator.h"
 
 namespace oceanbase {
 using namespace common;
@@ -90,6 +93,292 @@ TEST_F(ObMultipleMergeTest, test_sort_sstables_overlap)
   ASSERT_EQ(OB_SUCCESS, ret);
 }
 
+static const int64_t STREAM_COL_CNT = 2;
+
+// scan merge of mock iterators, iterator 0 is the newest one
+class ObMockStreamScanMerge : public ObMultipleScanMergeImpl {
+public:
+  ObMockStreamScanMerge() = default;
+  virtual ~ObMockStreamScanMerge() = default;
+  int init(const bool reverse, const int64_t iter_cnt, ObTableAccessContext& context, ObIAllocator& allocator);
+  int add_consumer_iter(ObStoreRowIterator& iter);
+
+protected:
+  virtual int calc_scan_range() override
+  {
+    return OB_SUCCESS;
+  }
+  virtual int construct_iters() override
+  {
+    return OB_SUCCESS;
+  }
+  virtual int is_range_valid() const override
+  {
+    return OB_SUCCESS;
+  }
+  virtual void collect_merge_stat(ObTableStoreStat& stat) const override
+  {
+    UNUSED(stat);
+  }
+};
+
+int ObMockStreamScanMerge::init(
+    const bool reverse, const int64_t iter_cnt, ObTableAccessContext& context, ObIAllocator& allocator)
+{
+  int ret = OB_SUCCESS;
+  ObColDescArray col_descs;
+  share::schema::ObColDesc col_desc;
+  col_desc.col_type_.set_int();
+  access_ctx_ = &context;
+  for (int64_t i = 0; OB_SUCC(ret) && i < STREAM_COL_CNT; ++i) {
+    col_desc.col_id_ = OB_APP_MIN_COLUMN_ID + i;
+    ret = col_descs.push_back(col_desc);
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(tree_cmp_.init(1 /*rowkey_cnt*/, col_descs, reverse, false, true, allocator))) {
+    STORAGE_LOG(WARN, "failed to init tree cmp", K(ret));
+  } else if (OB_FAIL(loser_tree_.init(iter_cnt, allocator))) {
+    STORAGE_LOG(WARN, "failed to init loser tree", K(ret));
+  } else if (OB_FAIL(nop_pos_.init(allocator, OB_ROW_MAX_COLUMNS_COUNT))) {
+    STORAGE_LOG(WARN, "failed to init nop pos", K(ret));
+  }
+  return ret;
+}
+
+int ObMockStreamScanMerge::add_consumer_iter(ObStoreRowIterator& iter)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(add_iterator(iter))) {
+    STORAGE_LOG(WARN, "failed to add iterator", K(ret));
+  } else {
+    consumer_.add_consumer(iters_.count() - 1);
+  }
+  return ret;
+}
+
+class ObMultipleScanMergeStreamTest : public ::testing::Test {
+public:
+  static const int64_t MAX_ITER_CNT = 4;
+  ObMultipleScanMergeStreamTest() : allocator_(ObModIds::OB_ST_TEMP), row_(nullptr), fresh_ts_(0)
+  {}
+  virtual ~ObMultipleScanMergeStreamTest() = default;
+  virtual void SetUp() override;
+  // rows of each iterator are "key value flag", ordered in the scan direction
+  void prepare(const char* data[], const int64_t iter_cnt, const bool reverse = false);
+  void check_next(const int64_t key, const int64_t value, const int64_t stream_iter_idx);
+  void check_end();
+  ObStoreRow* get_row(const int64_t iter_idx, const int64_t row_idx);
+
+protected:
+  ObArenaAllocator allocator_;
+  memtable::ObMemtableCtx mem_ctx_;
+  ObStoreCtx store_ctx_;
+  ObTableAccessContext access_ctx_;
+  ObMockIterator* iters_[MAX_ITER_CNT];
+  ObStoreRow* row_;
+  int64_t fresh_ts_;
+  // destructs the iterators, declared last
+  ObMockStreamScanMerge merge_;
+};
+
+void ObMultipleScanMergeStreamTest::SetUp()
+{
+  store_ctx_.mem_ctx_ = &mem_ctx_;
+  access_ctx_.store_ctx_ = &store_ctx_;
+  ASSERT_EQ(OB_SUCCESS, malloc_store_row(allocator_, STREAM_COL_CNT, row_));
+}
+
+void ObMultipleScanMergeStreamTest::prepare(const char* data[], const int64_t iter_cnt, const bool reverse)
+{
+  void* buf = nullptr;
+  ObStoreRow* row = nullptr;
+  ASSERT_TRUE(iter_cnt > 0 && iter_cnt <= MAX_ITER_CNT);
+  ASSERT_EQ(OB_SUCCESS, merge_.init(reverse, iter_cnt, access_ctx_, allocator_));
+  // rows popped from the loser tree just now, no range purge is due
+  fresh_ts_ = ObClockGenerator::getClock();
+  for (int64_t i = 0; i < iter_cnt; ++i) {
+    ASSERT_NE(nullptr, buf = allocator_.alloc(sizeof(ObMockIterator)));
+    iters_[i] = new (buf) ObMockIterator();
+    ASSERT_EQ(OB_SUCCESS, iters_[i]->from(data[i]));
+    for (int64_t j = 0; j < iters_[i]->count(); ++j) {
+      ASSERT_EQ(OB_SUCCESS, iters_[i]->get_row(j, row));
+      row->last_purge_ts_ = fresh_ts_;
+    }
+    ASSERT_EQ(OB_SUCCESS, merge_.add_consumer_iter(*iters_[i]));
+  }
+}
+
+void ObMultipleScanMergeStreamTest::check_next(const int64_t key, const int64_t value, const int64_t stream_iter_idx)
+{
+  ASSERT_EQ(OB_SUCCESS, merge_.inner_get_next_row(*row_));
+  ASSERT_EQ(ObActionFlag::OP_ROW_EXIST, row_->flag_);
+  ASSERT_EQ(STREAM_COL_CNT, row_->row_val_.count_);
+  ASSERT_EQ(key, row_->row_val_.cells_[0].get_int());
+  ASSERT_EQ(value, row_->row_val_.cells_[1].get_int());
+  // -1 if the next row has to go through the loser tree
+  ASSERT_EQ(stream_iter_idx, merge_.stream_iter_idx_);
+}
+
+void ObMultipleScanMergeStreamTest::check_end()
+{
+  ASSERT_EQ(OB_ITER_END, merge_.inner_get_next_row(*row_));
+  ASSERT_EQ(-1, merge_.stream_iter_idx_);
+}
+
+ObStoreRow* ObMultipleScanMergeStreamTest::get_row(const int64_t iter_idx, const int64_t row_idx)
+{
+  ObStoreRow* row = nullptr;
+  if (OB_SUCCESS != iters_[iter_idx]->get_row(row_idx, row)) {
+    row = nullptr;
+  }
+  return row;
+}
+
+TEST_F(ObMultipleScanMergeStreamTest, disjoint_ranges)
+{
+  const char* data[] = {"bigint bigint flag\n"
+                        "1      10     EXIST\n"
+                        "2      20     EXIST\n"
+                        "3      30     EXIST\n",
+      "bigint bigint flag\n"
+      "7      70     EXIST\n"
+      "8      80     EXIST\n"};
+  prepare(data, 2);
+  check_next(1, 10, 0);
+  ASSERT_TRUE(merge_.has_stream_bound_);
+  ASSERT_EQ(7, merge_.stream_bound_.row_->row_val_.cells_[0].get_int());
+  check_next(2, 20, 0);
+  check_next(3, 30, 0);
+  // the other iterators are all ended, no bound to check
+  check_next(7, 70, 1);
+  ASSERT_FALSE(merge_.has_stream_bound_);
+  check_next(8, 80, 1);
+  check_end();
+  ASSERT_EQ(5, merge_.get_row_stat().result_row_count_);
+}
+
+TEST_F(ObMultipleScanMergeStreamTest, interleaved_ranges)
+{
+  const char* data[] = {"bigint bigint flag\n"
+                        "1      10     EXIST\n"
+                        "3      30     EXIST\n"
+                        "4      40     EXIST\n"
+                        "6      60     EXIST\n",
+      "bigint bigint flag\n"
+      "2      20     EXIST\n"
+      "5      50     EXIST\n"
+      "7      70     EXIST\n"};
+  prepare(data, 2);
+  check_next(1, 10, 0);
+  check_next(2, 20, 1);
+  ASSERT_EQ(3, merge_.stream_bound_.row_->row_val_.cells_[0].get_int());
+  check_next(3, 30, 0);
+  check_next(4, 40, 0);
+  check_next(5, 50, 1);
+  check_next(6, 60, 0);
+  check_next(7, 70, 1);
+  check_end();
+}
+
+TEST_F(ObMultipleScanMergeStreamTest, key_equal_to_bound)
+{
+  // the stream of the newer iterator reaches the key of the older one
+  const char* data1[] = {"bigint bigint flag\n"
+                         "1      10     EXIST\n"
+                         "2      20     EXIST\n"
+                         "5      50     EXIST\n",
+      "bigint bigint flag\n"
+      "5      500    EXIST\n"
+      "6      600    EXIST\n"};
+  prepare(data1, 2);
+  check_next(1, 10, 0);
+  check_next(2, 20, 0);
+  // fused by the loser tree, the newer row wins
+  check_next(5, 50, -1);
+  check_next(6, 600, 1);
+  check_end();
+}
+
+TEST_F(ObMultipleScanMergeStreamTest, key_equal_to_bound_of_newer_iter)
+{
+  // the stream of the older iterator reaches the key of the newer one
+  const char* data[] = {"bigint bigint flag\n"
+                        "5      50     EXIST\n"
+                        "6      60     EXIST\n",
+      "bigint bigint flag\n"
+      "1      100    EXIST\n"
+      "2      200    EXIST\n"
+      "5      500    EXIST\n"};
+  prepare(data, 2);
+  check_next(1, 100, 1);
+  check_next(2, 200, 1);
+  check_next(5, 50, -1);
+  check_next(6, 60, 0);
+  check_end();
+}
+
+TEST_F(ObMultipleScanMergeStreamTest, delete_row_stops_stream)
+{
+  const char* data[] = {"bigint bigint flag\n"
+                        "1      10     EXIST\n"
+                        "2      NOP    DELETE\n"
+                        "3      30     EXIST\n",
+      "bigint bigint flag\n"
+      "2      20     EXIST\n"
+      "4      40     EXIST\n"};
+  prepare(data, 2);
+  check_next(1, 10, 0);
+  // the delete row goes through the loser tree and hides the older row
+  check_next(3, 30, 0);
+  ASSERT_EQ(1, merge_.get_row_stat().filt_del_count_);
+  check_next(4, 40, 1);
+  check_end();
+  ASSERT_EQ(3, merge_.get_row_stat().result_row_count_);
+}
+
+TEST_F(ObMultipleScanMergeStreamTest, reverse_scan)
+{
+  const char* data[] = {"bigint bigint flag\n"
+                        "9      90     EXIST\n"
+                        "8      80     EXIST\n"
+                        "5      50     EXIST\n",
+      "bigint bigint flag\n"
+      "5      500    EXIST\n"
+      "3      300    EXIST\n"
+      "1      100    EXIST\n"};
+  prepare(data, 2, true /*reverse*/);
+  check_next(9, 90, 0);
+  ASSERT_EQ(5, merge_.stream_bound_.row_->row_val_.cells_[0].get_int());
+  check_next(8, 80, 0);
+  check_next(5, 50, -1);
+  check_next(3, 300, 1);
+  ASSERT_FALSE(merge_.has_stream_bound_);
+  check_next(1, 100, 1);
+  check_end();
+}
+
+TEST_F(ObMultipleScanMergeStreamTest, range_purge_stops_stream)
+{
+  const char* data[] = {"bigint bigint flag\n"
+                        "1      10     EXIST\n"
+                        "2      20     EXIST\n"
+                        "3      30     EXIST\n",
+      "bigint bigint flag\n"
+      "7      70     EXIST\n"};
+  prepare(data, 2);
+  const int64_t stale_ts = fresh_ts_ - 2 * ObMultipleScanMergeImpl::RANGE_PURGE_INTERVAL_US;
+  get_row(0, 1)->last_purge_ts_ = stale_ts;
+  check_next(1, 10, 0);
+  // the purge check of row 2 is due, the loser tree pops it and does the check
+  check_next(2, 20, 0);
+  ASSERT_GT(get_row(0, 1)->last_purge_ts_, stale_ts);
+  // row 3 is streamed without the check
+  check_next(3, 30, 0);
+  ASSERT_EQ(fresh_ts_, get_row(0, 2)->last_purge_ts_);
+  check_next(7, 70, 1);
+  check_end();
+}
+
 }  // end namespace unittest
 }  // end namespace oceanbase
 
@@ -11,6 +11,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <math.h>
 #include "storage/ob_table_store_stat_mgr.h"
 namespace oceanbase {
 using namespace common;
@@ -127,6 +128,93 @@ TEST(TestTableStoreStatMgr, lru)
   ASSERT_EQ(104, output.row_cache_miss_cnt_);
   ObTableStoreStatMgr::get_instance().destroy();
 }
+
+TEST(TestTableStoreStatMgr, sample_load)
+{
+  const int64_t MINUTE_US = 60 * 1000 * 1000L;
+  // weight of a one minute sample
+  const double alpha = 1 - exp(-static_cast<double>(MINUTE_US) / ObTableStoreStatNode::LOAD_DECAY_US);
+  ObTableStoreStatNode node;
+  int64_t now = 1000 * MINUTE_US;
+  int64_t io_cnt = 1000;
+
+  // the first sample is the base
+  node.sample_load(now, io_cnt);
+  ASSERT_EQ(now, node.sample_ts_);
+  ASSERT_EQ(io_cnt, node.sample_io_cnt_);
+  ASSERT_EQ(0, node.io_rate_);
+
+  // 100 ios per second for a minute
+  now += MINUTE_US;
+  io_cnt += 100 * 60;
+  node.sample_load(now, io_cnt);
+  ASSERT_NEAR(100 * alpha, node.io_rate_, 1e-6);
+
+  // reaches 1 - 1/e of a steady rate after the decay time
+  for (int64_t i = 1; i < 15; ++i) {
+    now += MINUTE_US;
+    io_cnt += 100 * 60;
+    node.sample_load(now, io_cnt);
+  }
+  ASSERT_NEAR(100 * (1 - exp(-1)), node.io_rate_, 1e-6);
+  for (int64_t i = 0; i < 300; ++i) {
+    now += MINUTE_US;
+    io_cnt += 100 * 60;
+    node.sample_load(now, io_cnt);
+  }
+  ASSERT_NEAR(100, node.io_rate_, 1e-3);
+
+  // a one minute burst of 100 times the load moves the rate by less than 7% of the burst
+  now += MINUTE_US;
+  io_cnt += 10000 * 60;
+  node.sample_load(now, io_cnt);
+  ASSERT_NEAR(100 + 9900 * alpha, node.io_rate_, 1e-3);
+  ASSERT_LT(node.io_rate_ - 100, 9900 * 0.07);
+  for (int64_t i = 0; i < 15; ++i) {
+    now += MINUTE_US;
+    io_cnt += 100 * 60;
+    node.sample_load(now, io_cnt);
+  }
+  ASSERT_NEAR(100 + 9900 * alpha * exp(-1), node.io_rate_, 1e-3);
+
+  // a two minutes sample weighs as two one minute samples
+  ObTableStoreStatNode node2 = node;
+  now += 2 * MINUTE_US;
+  io_cnt += 400 * 120;
+  node.sample_load(now, io_cnt);
+  node2.sample_load(now - MINUTE_US, io_cnt - 400 * 60);
+  node2.sample_load(now, io_cnt);
+  ASSERT_NEAR(node2.io_rate_, node.io_rate_, 1e-6);
+
+  // the clock goes back, nothing changes
+  const double io_rate = node.io_rate_;
+  node.sample_load(now - MINUTE_US, io_cnt + 100);
+  ASSERT_EQ(io_rate, node.io_rate_);
+  ASSERT_EQ(now, node.sample_ts_);
+  ASSERT_EQ(io_cnt, node.sample_io_cnt_);
+
+  // the stat is reset, counts from zero
+  ObTableStoreStatNode node3 = node;
+  now += MINUTE_US;
+  node.sample_load(now, 100 * 60);
+  node3.sample_load(now, io_cnt + 100 * 60);
+  ASSERT_NEAR(node3.io_rate_, node.io_rate_, 1e-6);
+
+  node.reset_load();
+  ASSERT_EQ(0, node.sample_ts_);
+  ASSERT_EQ(0, node.io_rate_);
+}
+
+TEST(TestTableStoreStatMgr, io_cnt)
+{
+  ObTableStoreStat stat;
+  stat.single_get_stat_.call_cnt_ = 100;
+  stat.single_scan_stat_.call_cnt_ = 100;
+  stat.block_cache_hit_cnt_ = 1000;
+  ASSERT_EQ(0, stat.get_io_cnt());
+  stat.block_cache_miss_cnt_ = 10;
+  ASSERT_EQ(10, stat.get_io_cnt());
+}
 }  // end namespace unittest
 }  // end namespace oceanbase
 